@@ -156,6 +156,17 @@ public:
      */
     void StartAsync();
 
+    /**
+     * @brief Start inference of specified input(s) in asynchronous mode with the scheduling hints
+     *
+     * @note It returns immediately. Requests with higher priority are started by the device executor first,
+     * requests waiting too long get their priority raised, so low priority requests are not starved.
+     * @param priority Scheduling priority, requests started by StartAsync() without arguments have zero priority
+     * @param deadline_ms Optional deadline in milliseconds relative to the call. Requests with the same priority
+     * are started in the deadline order. Zero means no deadline
+     */
+    void StartAsync(int priority, int64_t deadline_ms = 0);
+
     /**
      * @brief Waits for the result to become available. Blocks until specified millis_timeout has elapsed or the result
      * becomes available, whichever comes first.
@@ -168,6 +168,27 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the placement of the weights and the workspace memory of each CPU stream over NUMA nodes,
+ * one string per stream in bytes per node, -1 stands for the pages which are not touched yet.
+ * String value is "CPU_NUMA_NODES_PLACEMENT"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_NUMA_NODES_PLACEMENT, std::vector<std::string>);
+
+/**
+ * @brief Metric to get the queueing delay of the CPU infer requests per priority class,
+ * one string per class with the number of requests, the average and the maximum delay in milliseconds.
+ * Requests started without the priority hints are not accounted. String value is "CPU_QUEUEING_DELAY"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_QUEUEING_DELAY, std::vector<std::string>);
+
+/**
+ * @brief Metric to get the intermediate tensors workspace statistics of each CPU stream, one string per stream
+ * with the workspace size, its fragmentation and the tensors released to fit the memory budget.
+ * String value is "CPU_MEMORY_STATISTICS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_MEMORY_STATISTICS, std::vector<std::string>);
+
 }  // namespace Metrics
 
 /**
@@ -235,6 +256,84 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The key enables automatic selection of the CPU streams, threads per stream and threads binding at LoadNetwork.
+ *
+ * The plugin runs the network with a few candidate configurations within the time budget
+ * (see KEY_CPU_AUTO_TUNE_TIME_BUDGET_MS) and keeps the best one. This option should be used with values:
+ * - PluginConfigParams::CPU_AUTO_TUNE_THROUGHPUT selects the configuration with the maximal number of inferences per second
+ * - PluginConfigParams::CPU_AUTO_TUNE_LATENCY selects the single stream configuration with the minimal latency
+ * - PluginConfigParams::NO (default) uses KEY_CPU_THROUGHPUT_STREAMS, KEY_CPU_THREADS_NUM and KEY_CPU_BIND_THREAD as is
+ * The decision is cached per network and machine within the process and, if KEY_CPU_AUTO_TUNE_CACHE_DIR is set,
+ * in the given folder, so next loads of the same network skip the tuning.
+ */
+DECLARE_CONFIG_VALUE(CPU_AUTO_TUNE_THROUGHPUT);
+DECLARE_CONFIG_VALUE(CPU_AUTO_TUNE_LATENCY);
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_AUTO_TUNE);
+
+/**
+ * @brief The key sets the time budget in milliseconds for running the candidate configurations
+ * during KEY_CPU_THROUGHPUT_AUTO_TUNE, positive integer value, 2000 by default.
+ */
+DECLARE_CONFIG_KEY(CPU_AUTO_TUNE_TIME_BUDGET_MS);
+
+/**
+ * @brief The key sets the folder to store KEY_CPU_THROUGHPUT_AUTO_TUNE decisions in,
+ * empty string (default) keeps them in the process memory only.
+ */
+DECLARE_CONFIG_KEY(CPU_AUTO_TUNE_CACHE_DIR);
+
+/**
+ * @brief The key enables backing of the intermediate tensors workspace and constant weights of the CPU plugin
+ * with 2 MB huge pages to reduce TLB misses for large models.
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * Explicit huge pages are used if they are reserved in the system, otherwise transparent huge pages are requested.
+ * Buffers smaller than a huge page and systems without huge pages support fall back to the regular allocation.
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+/**
+ * @brief The key keeps the weights of the FullyConnected layers of the CPU plugin compressed in memory,
+ * the weights are converted to FP32 in registers during the inference.
+ *
+ * It roughly halves (FP16) or quarters (INT8) the memory and the memory bandwidth taken by the weights of
+ * memory bound layers like the projections of decoders running with a small batch.
+ * This option should be used with values:
+ * - KEY_CPU_WEIGHTS_FP16 stores the weights in FP16, lossless for the weights which come from an FP16 IR
+ * - KEY_CPU_WEIGHTS_INT8 stores the weights in INT8 with a scale per output channel
+ * - PluginConfigParams::NO (default) keeps the FP32 weights
+ * Layers with non FP32 inputs or outputs (quantized or BF16 ones) are not affected.
+ */
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_FP16);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_INT8);
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION);
+
+/**
+ * @brief The key sets the budget in megabytes for the intermediate tensors workspace of each CPU stream,
+ * non negative integer value, 0 (default) means no budget.
+ *
+ * If the workspace doesn't fit the budget, tensors which are not needed for a long part of the execution are
+ * released between their uses: the ones produced by cheap layers are recomputed before the next use, the others
+ * are spilled to a temporary file. The workspace may still exceed the budget if there are no such tensors.
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_BUDGET_MB);
+
+/**
+ * @brief The key defers the preparation of the constant data of the CPU plugin (reordering and quantization of
+ * the weights) from LoadNetwork() to trade the load time for the latency of the first inference.
+ *
+ * This option should be used with values:
+ * - PluginConfigParams::CPU_CONSTANTS_BACKGROUND prepares the constants in a background thread started by LoadNetwork()
+ * - PluginConfigParams::CPU_CONSTANTS_ON_FIRST_INFER prepares the constants by the first inference of each stream
+ * - PluginConfigParams::NO (default) prepares the constants during LoadNetwork()
+ * In both deferred modes an inference waits only for the constants of the layers it is about to execute.
+ */
+DECLARE_CONFIG_VALUE(CPU_CONSTANTS_BACKGROUND);
+DECLARE_CONFIG_VALUE(CPU_CONSTANTS_ON_FIRST_INFER);
+DECLARE_CONFIG_KEY(CPU_DEFERRED_CONSTANTS);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -62,6 +62,10 @@ static const char enforce_bf16_message[] = "Optional. By default floating point
                                            "                                  'true'  - enable  bfloat16 regardless of platform support\n"
                                            "                                  'false' - disable bfloat16 regardless of platform support";
 
+/// @brief message for huge pages usage on CPU
+static const char huge_pages_message[] = "Optional. Back CPU plugin workspace and weights with 2 MB huge pages. Useful to measure TLB misses impact "
+                                         "on large models: compare latency of runs with 'true' and 'false'.";
+
 /// @brief message for user library argument
 static const char custom_cpu_library_message[] = "Required for CPU custom layers. Absolute path to a shared library with the kernels "
                                                  "implementations.";
@@ -95,9 +99,24 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for multi-model option
+static const char multi_model_message[] = "Optional. Run several models concurrently in one Inference Engine Core instead of the -m model. "
+                                          "For example, \"model1.xml[4,2],model2.xml[2],model3.xml\", where optional values in brackets "
+                                          "are the number of infer requests and the number of streams for the model. "
+                                          "Each model is measured alone and then all models are measured concurrently.";
+
+// @brief message for json_stats option
+static const char json_stats_message[] = "Optional. Enables JSON-based statistics output in addition to the CSV report. "
+                                         "The report contains execution results, latency percentiles and throughput timeline.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for target qps option
+static const char target_qps_message[] = "Optional. Target number of inference requests started per second (open-loop mode). "
+                                         "Requests are started on a fixed schedule regardless of completion of the previous ones "
+                                         "and latency is measured from the scheduled start time. Supported for async API only.";
+
 // @brief message for progress bar option
 static const char progress_message[] = "Optional. Show progress bar (can affect performance measurement). Default values is "
                                        "\"false\".";
@@ -174,6 +193,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Models to run concurrently with per-model number of infer requests and streams
+DEFINE_string(mm, "", multi_model_message);
+
+/// @brief Target rate of started infer requests per second (0 means closed-loop execution)
+DEFINE_double(qps, 0, target_qps_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero
 /// cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
@@ -184,6 +209,9 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
+/// @brief Backs CPU plugin memory with huge pages
+DEFINE_bool(huge_pages, false, huge_pages_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -200,6 +228,9 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Enables JSON statistics report
+DEFINE_bool(json_stats, false, json_stats_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -256,6 +287,8 @@ static void showUsage() {
     std::cout << "    -api \"<sync/async>\"       " << api_message << std::endl;
     std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << target_qps_message << std::endl;
+    std::cout << "    -mm \"<models>\"            " << multi_model_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
@@ -266,10 +299,12 @@ static void showUsage() {
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
     std::cout << "    -enforcebf16=<true/false>     " << enforce_bf16_message << std::endl;
+    std::cout << "    -huge_pages=<true/false>      " << huge_pages_message << std::endl;
     std::cout << "    -pin \"YES\"/\"HYBRID_AWARE\"/\"NO\"/\"NUMA\"   " << infer_threads_pinning_message << std::endl;
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
+    std::cout << "    -json_stats               " << json_stats_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
@@ -39,7 +39,12 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request and measures its latency from the given (possibly earlier) scheduled start time
+    void startAsync(const Time::time_point& scheduledTime) {
+        _startTime = scheduledTime;
         _request.StartAsync();
     }
 
@@ -98,6 +103,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _completionTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -106,9 +112,11 @@ public:
 
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
+        auto now = Time::now();
         _latencies.push_back(latency);
+        _completionTimes.push_back(now);
         _idleIds.push(id);
-        _endTime = std::max(Time::now(), _endTime);
+        _endTime = std::max(now, _endTime);
         _cv.notify_one();
     }
 
@@ -134,6 +142,19 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns number of completed requests for each second since the first request was started
+    std::vector<size_t> getCompletionsPerSecond() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        std::vector<size_t> completions;
+        for (auto& time : _completionTimes) {
+            auto second = static_cast<size_t>(std::chrono::duration_cast<std::chrono::seconds>(time - _startTime).count());
+            if (completions.size() <= second)
+                completions.resize(second + 1, 0);
+            completions[second]++;
+        }
+        return completions;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -143,4 +164,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<Time::time_point> _completionTimes;
 };
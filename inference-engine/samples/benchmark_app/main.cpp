@@ -13,6 +13,7 @@
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -20,6 +21,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "multi_model.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -47,11 +49,15 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_mm.empty()) {
         showUsage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
+    if (!FLAGS_mm.empty() && (FLAGS_api != "async" || FLAGS_qps > 0)) {
+        throw std::logic_error("Multi-model mode (-mm option) is supported for closed-loop async API only.");
+    }
+
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
@@ -66,6 +72,14 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect target QPS. Please set -qps option to a positive value.");
+    }
+
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-qps option) is supported for async API only.");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -99,14 +113,6 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T>& vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ? sortedVec[sortedVec.size() / 2ULL]
-                                       : (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
-}
-
 /**
  * @brief The entry point of the benchmark application
  */
@@ -136,8 +142,8 @@ int main(int argc, char* argv[]) {
                 command_line_arguments.push_back({flag.name, flag.current_value});
             }
         }
-        if (!FLAGS_report_type.empty()) {
-            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config {FLAGS_report_type, FLAGS_report_folder});
+        if (!FLAGS_report_type.empty() || FLAGS_json_stats) {
+            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config {FLAGS_report_type, FLAGS_report_folder, FLAGS_json_stats});
             statistics->addParameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
         auto isFlagSetInCommandLine = [&command_line_arguments](const std::string& name) {
@@ -260,6 +266,9 @@ int main(int argc, char* argv[]) {
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
+                if (isFlagSetInCommandLine("huge_pages"))
+                    device_config[CONFIG_KEY(CPU_HUGE_PAGES)] = FLAGS_huge_pages ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
+
                 if (isFlagSetInCommandLine("pin")) {
                     // set to user defined value
                     device_config[CONFIG_KEY(CPU_BIND_THREAD)] = FLAGS_pin;
@@ -316,6 +325,15 @@ int main(int argc, char* argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
+        if (!FLAGS_mm.empty()) {
+            // Device configuration above is shared by all networks, per-model values are passed on network loading
+            uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : deviceDefaultDeviceDurationInSeconds(device_name);
+            runMultiModelBenchmark(ie, device_name, parseMultiModelConfig(FLAGS_mm), inputFiles, duration_seconds, statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto double_to_string = [](const double number) {
             std::stringstream ss;
             ss << std::fixed << std::setprecision(2) << number;
@@ -482,6 +500,11 @@ int main(int argc, char* argv[]) {
                                           {"number of parallel infer requests", std::to_string(nireq)},
                                           {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (FLAGS_qps > 0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG, {
+                                                                                          {"target qps", double_to_string(FLAGS_qps)},
+                                                                                      });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -535,6 +558,9 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (FLAGS_qps > 0) {
+            ss << ", target " << FLAGS_qps << " requests per second";
+        }
         next_step(ss.str());
 
         // warming up - out of scope
@@ -562,8 +588,18 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // In the open-loop mode requests are started on a fixed schedule, so the latency includes waiting for an idle request
+        const bool openLoop = FLAGS_qps > 0;
+        const auto scheduleInterval = openLoop ? std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(1.0 / FLAGS_qps))
+                                               : Time::duration::zero();
+
         while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            auto scheduledTime = startTime + scheduleInterval * iteration;
+            if (openLoop) {
+                std::this_thread::sleep_until(scheduledTime);
+            }
+
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -579,7 +615,11 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(scheduledTime);
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -602,10 +642,24 @@ int main(int argc, char* argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        auto latencies = inferRequestsQueue.getLatencies();
+        std::sort(latencies.begin(), latencies.end());
+        double latency = getMedianValue<double>(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
 
+        const std::vector<std::pair<std::string, double>> latencyPercentiles = {
+            {"p50", 50.0},
+            {"p90", 90.0},
+            {"p99", 99.0},
+            {"p99.9", 99.9},
+        };
+
+        std::vector<double> throughputTimeline;
+        for (auto completions : inferRequestsQueue.getCompletionsPerSecond()) {
+            throughputTimeline.push_back(static_cast<double>(batchSize * completions));
+        }
+
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
                                                                                          {"total execution time (ms)", double_to_string(totalDuration)},
@@ -615,8 +669,18 @@ int main(int argc, char* argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
                                                                                              {"latency (ms)", double_to_string(latency)},
                                                                                          });
+                for (auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {"latency " + percentile.first + " (ms)", double_to_string(getPercentileValue(latencies, percentile.second))},
+                                              });
+                }
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
+                                                                                             {"latency max (ms)", double_to_string(latencies.back())},
+                                                                                         });
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
+            statistics->addThroughputTimeline(throughputTimeline);
         }
 
         progressBar.finish();
@@ -662,9 +726,22 @@ int main(int argc, char* argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            for (auto& percentile : latencyPercentiles) {
+                std::cout << "    " << percentile.first << ":" << std::string(8 - percentile.first.size(), ' ')
+                          << double_to_string(getPercentileValue(latencies, percentile.second)) << " ms" << std::endl;
+            }
+            std::cout << "    max:     " << double_to_string(latencies.back()) << " ms" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (FLAGS_stream_output || FLAGS_json_stats) {
+            std::cout << "Throughput timeline (FPS per second):";
+            for (auto value : throughputTimeline) {
+                std::cout << " " << double_to_string(value);
+            }
+            std::cout << std::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+struct ModelContext {
+    benchmark_app::ModelConfig config;
+    std::string name;
+    size_t batchSize = 1;
+    ExecutableNetwork exeNetwork;
+    std::unique_ptr<InferRequestsQueue> inferRequestsQueue;
+};
+
+struct RunResult {
+    size_t iterations = 0;
+    double durationMs = 0.0;
+    std::vector<double> latencies;
+
+    double fps(size_t batchSize) const {
+        return durationMs > 0.0 ? batchSize * 1000.0 * iterations / durationMs : 0.0;
+    }
+    double percentile(double value) const {
+        return latencies.empty() ? 0.0 : getPercentileValue(latencies, value);
+    }
+};
+
+std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+RunResult runModel(ModelContext& model, uint64_t duration_nanoseconds) {
+    auto& queue = *model.inferRequestsQueue;
+    const size_t nireq = queue.requests.size();
+    queue.resetTimes();
+
+    RunResult result;
+    auto startTime = Time::now();
+    uint64_t execTime = 0;
+    while (execTime < duration_nanoseconds || result.iterations % nireq != 0) {
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+        // rethrows exception of the previous execution of the request, if any
+        inferRequest->wait();
+        inferRequest->startAsync();
+        result.iterations++;
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    }
+    queue.waitAll();
+
+    result.durationMs = queue.getDurationInMilliseconds();
+    result.latencies = queue.getLatencies();
+    std::sort(result.latencies.begin(), result.latencies.end());
+    return result;
+}
+}  // namespace
+
+std::vector<benchmark_app::ModelConfig> parseMultiModelConfig(const std::string& models_string) {
+    std::vector<benchmark_app::ModelConfig> models;
+    std::string search_string = models_string;
+    while (!search_string.empty()) {
+        benchmark_app::ModelConfig model {"", 0, ""};
+        auto bracket_pos = search_string.find_first_of('[');
+        auto comma_pos = search_string.find_first_of(',');
+        if (bracket_pos != std::string::npos && (comma_pos == std::string::npos || bracket_pos < comma_pos)) {
+            auto end_pos = search_string.find_first_of(']', bracket_pos);
+            if (end_pos == std::string::npos)
+                throw std::logic_error("Can't parse multi-model parameter string: " + models_string);
+            model.path = search_string.substr(0, bracket_pos);
+            auto values = split(search_string.substr(bracket_pos + 1, end_pos - bracket_pos - 1), ',');
+            if (values.size() > 2)
+                throw std::logic_error("Only number of infer requests and number of streams can be set for a model: " + models_string);
+            if (values.size() > 0 && !values[0].empty())
+                model.nireq = static_cast<uint32_t>(std::stoul(values[0]));
+            if (values.size() > 1)
+                model.nstreams = values[1];
+            search_string = search_string.substr(end_pos + 1);
+            if (!search_string.empty() && search_string.front() != ',')
+                throw std::logic_error("Can't parse multi-model parameter string: " + models_string);
+        } else {
+            model.path = search_string.substr(0, comma_pos);
+            search_string = comma_pos == std::string::npos ? "" : search_string.substr(comma_pos);
+        }
+        if (!search_string.empty())
+            search_string = search_string.substr(1);
+        if (model.path.empty())
+            throw std::logic_error("Empty model path in multi-model parameter string: " + models_string);
+        models.push_back(model);
+    }
+    return models;
+}
+
+void runMultiModelBenchmark(Core& ie, const std::string& device_name, const std::vector<benchmark_app::ModelConfig>& models,
+                            const std::vector<std::string>& inputFiles, uint32_t duration_seconds, const std::shared_ptr<StatisticsReport>& statistics) {
+    const uint64_t duration_nanoseconds = duration_seconds * 1000000000LL;
+
+    std::vector<ModelContext> contexts(models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        auto& context = contexts[i];
+        context.config = models[i];
+
+        slog::info << "Loading network " << context.config.path << slog::endl;
+        CNNNetwork cnnNetwork = ie.ReadNetwork(context.config.path);
+        // the same model may be loaded several times, so the index keeps the names unique
+        context.name = std::to_string(i) + ":" + cnnNetwork.getName();
+
+        auto app_inputs_info = getInputsInfo<InputInfo::Ptr>("", "", 0, cnnNetwork.getInputsInfo());
+        for (auto& item : cnnNetwork.getInputsInfo()) {
+            if (app_inputs_info.at(item.first).isImage()) {
+                app_inputs_info.at(item.first).precision = Precision::U8;
+                item.second->setPrecision(Precision::U8);
+            }
+        }
+        context.batchSize = cnnNetwork.getBatchSize();
+
+        std::map<std::string, std::string> network_config;
+        if (!context.config.nstreams.empty()) {
+            for (auto& device : parseDevices(device_name)) {
+                network_config[device + "_THROUGHPUT_STREAMS"] = context.config.nstreams;
+            }
+        }
+        context.exeNetwork = ie.LoadNetwork(cnnNetwork, device_name, network_config);
+
+        uint32_t nireq = context.config.nireq;
+        if (nireq == 0) {
+            nireq = context.exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+        context.inferRequestsQueue.reset(new InferRequestsQueue(context.exeNetwork, nireq));
+        fillBlobs(inputFiles, context.batchSize, app_inputs_info, context.inferRequestsQueue->requests);
+
+        // warming up - out of scope
+        auto inferRequest = context.inferRequestsQueue->getIdleRequest();
+        inferRequest->startAsync();
+        context.inferRequestsQueue->waitAll();
+
+        slog::info << "Network " << context.name << " is loaded with " << nireq << " infer requests"
+                   << (context.config.nstreams.empty() ? "" : " and " + context.config.nstreams + " streams") << slog::endl;
+    }
+
+    // Each model runs alone first to get the reference numbers for the interference estimation
+    std::vector<RunResult> soloResults;
+    for (auto& context : contexts) {
+        slog::info << "Measuring " << context.name << " alone, " << duration_seconds << " s" << slog::endl;
+        soloResults.push_back(runModel(context, duration_nanoseconds));
+    }
+
+    slog::info << "Measuring " << contexts.size() << " networks concurrently, " << duration_seconds << " s" << slog::endl;
+    std::vector<RunResult> concurrentResults(contexts.size());
+    std::vector<std::exception_ptr> exceptions(contexts.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < contexts.size(); i++) {
+        threads.emplace_back([&, i] {
+            try {
+                concurrentResults[i] = runModel(contexts[i], duration_nanoseconds);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    for (size_t i = 0; i < contexts.size(); i++) {
+        const auto& context = contexts[i];
+        const auto& solo = soloResults[i];
+        const auto& concurrent = concurrentResults[i];
+        double soloFps = solo.fps(context.batchSize);
+        double concurrentFps = concurrent.fps(context.batchSize);
+        double slowdown = concurrentFps > 0.0 ? soloFps / concurrentFps : 0.0;
+
+        std::cout << "Network " << context.name << " (" << context.config.path << ")" << std::endl;
+        std::cout << "    Alone:      " << double_to_string(soloFps) << " FPS, latency p50 " << double_to_string(solo.percentile(50.0))
+                  << " ms, p99 " << double_to_string(solo.percentile(99.0)) << " ms" << std::endl;
+        std::cout << "    Concurrent: " << double_to_string(concurrentFps) << " FPS, latency p50 " << double_to_string(concurrent.percentile(50.0))
+                  << " ms, p99 " << double_to_string(concurrent.percentile(99.0)) << " ms" << std::endl;
+        std::cout << "    Slowdown:   " << double_to_string(slowdown) << "x" << std::endl;
+
+        if (statistics) {
+            const std::string prefix = context.name + " ";
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                          {prefix + "throughput alone", double_to_string(soloFps)},
+                                          {prefix + "throughput concurrent", double_to_string(concurrentFps)},
+                                          {prefix + "latency p50 alone (ms)", double_to_string(solo.percentile(50.0))},
+                                          {prefix + "latency p50 concurrent (ms)", double_to_string(concurrent.percentile(50.0))},
+                                          {prefix + "latency p99 alone (ms)", double_to_string(solo.percentile(99.0))},
+                                          {prefix + "latency p99 concurrent (ms)", double_to_string(concurrent.percentile(99.0))},
+                                          {prefix + "slowdown", double_to_string(slowdown)},
+                                      });
+        }
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <inference_engine.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "statistics_report.hpp"
+
+namespace benchmark_app {
+/// @brief Per-model settings of the multi-model mode
+struct ModelConfig {
+    std::string path;
+    uint32_t nireq;
+    std::string nstreams;
+};
+}  // namespace benchmark_app
+
+/**
+ * @brief Parses multi-model option string like "model1.xml[4,2],model2.xml[2],model3.xml"
+ * where optional values in brackets are number of infer requests and number of streams for the model
+ */
+std::vector<benchmark_app::ModelConfig> parseMultiModelConfig(const std::string& models_string);
+
+/**
+ * @brief Loads all models to one Core, measures each model alone and then all models running concurrently
+ * and reports per-model latency, throughput and slowdown caused by the concurrent execution
+ */
+void runMultiModelBenchmark(InferenceEngine::Core& ie, const std::string& device_name, const std::vector<benchmark_app::ModelConfig>& models,
+                            const std::vector<std::string>& inputFiles, uint32_t duration_seconds, const std::shared_ptr<StatisticsReport>& statistics);
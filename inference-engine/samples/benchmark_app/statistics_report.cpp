@@ -5,6 +5,7 @@
 #include "statistics_report.hpp"
 
 #include <algorithm>
+#include <fstream>
 #include <map>
 #include <string>
 #include <utility>
@@ -17,6 +18,10 @@ void StatisticsReport::addParameters(const Category& category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addThroughputTimeline(const std::vector<double>& timeline) {
+    _throughputTimeline = timeline;
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
@@ -50,7 +55,81 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (!_throughputTimeline.empty()) {
+        dumper << "Throughput timeline";
+        dumper.endLine();
+
+        dumper << "second"
+               << "throughput";
+        dumper.endLine();
+        for (size_t i = 0; i < _throughputTimeline.size(); i++) {
+            dumper << i << _throughputTimeline[i];
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
+
+    if (_config.json_stats)
+        dumpJson();
+}
+
+namespace {
+std::string escapeJson(const std::string& value) {
+    std::string result;
+    for (auto c : value) {
+        switch (c) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            result += c;
+        }
+    }
+    return result;
+}
+}  // namespace
+
+void StatisticsReport::dumpJson() {
+    const std::string filename = _config.report_folder + _separator + "benchmark_report.json";
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Can't open file " + filename + " to store the JSON statistics report");
+    }
+
+    static const std::map<Category, std::string> categoryNames = {{Category::COMMAND_LINE_PARAMETERS, "cmd_options"},
+                                                                  {Category::RUNTIME_CONFIG, "configuration_setup"},
+                                                                  {Category::EXECUTION_RESULTS, "execution_results"}};
+
+    file << "{";
+    bool firstCategory = true;
+    for (auto& category : _parameters) {
+        file << (firstCategory ? "" : ",") << "\n  \"" << categoryNames.at(category.first) << "\": {";
+        bool firstParameter = true;
+        for (auto& parameter : category.second) {
+            file << (firstParameter ? "" : ",") << "\n    \"" << escapeJson(parameter.first) << "\": \"" << escapeJson(parameter.second) << "\"";
+            firstParameter = false;
+        }
+        file << "\n  }";
+        firstCategory = false;
+    }
+    file << (firstCategory ? "" : ",") << "\n  \"throughput_timeline\": [";
+    for (size_t i = 0; i < _throughputTimeline.size(); i++) {
+        file << (i == 0 ? "" : ", ") << _throughputTimeline[i];
+    }
+    file << "]\n}\n";
+
+    slog::info << "JSON statistics report is stored to " << filename << slog::endl;
 }
 
 void StatisticsReport::dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts) {
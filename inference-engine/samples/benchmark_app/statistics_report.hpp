@@ -27,6 +27,7 @@ public:
     struct Config {
         std::string report_type;
         std::string report_folder;
+        bool json_stats;
     };
 
     enum class Category {
@@ -52,6 +53,8 @@ public:
 
     void addParameters(const Category& category, const Parameters& parameters);
 
+    void addThroughputTimeline(const std::vector<double>& timeline);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
@@ -59,12 +62,17 @@ public:
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts);
 
+    void dumpJson();
+
     // configuration of current benchmark execution
     const Config _config;
 
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // throughput for each second of execution
+    std::vector<double> _throughputTimeline;
+
     // csv separator
     std::string _separator;
 };
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <vector>
@@ -32,6 +34,23 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
 
+template <typename T>
+T getMedianValue(const std::vector<T>& vec) {
+    std::vector<T> sortedVec(vec);
+    std::sort(sortedVec.begin(), sortedVec.end());
+    return (sortedVec.size() % 2 != 0) ? sortedVec[sortedVec.size() / 2ULL]
+                                       : (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+}
+
+/**
+ * @brief Returns percentile of the sorted values using the nearest-rank method
+ */
+template <typename T>
+T getPercentileValue(const std::vector<T>& sortedVec, double percentile) {
+    size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max<size_t>(rank, 1ULL), sortedVec.size()) - 1ULL];
+}
+
 template <typename T>
 std::map<std::string, std::string> parseInputParameters(const std::string parameter_string, const std::map<std::string, T>& input_info) {
     // Parse parameter string like "input0[value0],input1[value1]" or "[value]" (applied to all
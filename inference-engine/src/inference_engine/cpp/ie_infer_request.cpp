@@ -111,6 +111,15 @@ void InferRequest::StartAsync() {
 }
 
 
+void InferRequest::StartAsync(int priority, int64_t deadline_ms) {
+    INFER_REQ_CALL_STATEMENT(
+        TaskPriority taskPriority;
+        taskPriority._priority = priority;
+        if (deadline_ms > 0)
+            taskPriority._deadline = TaskPriority::Clock::now() + std::chrono::milliseconds(deadline_ms);
+        _impl->StartAsyncWithPriority(taskPriority);)
+}
+
 StatusCode InferRequest::Wait(int64_t millis_timeout) {
     INFER_REQ_CALL_STATEMENT(return _impl->Wait(millis_timeout);)
 }
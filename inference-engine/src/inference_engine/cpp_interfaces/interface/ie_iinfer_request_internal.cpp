@@ -169,6 +169,11 @@ void IInferRequestInternal::StartAsync() {
     StartAsyncImpl();
 }
 
+void IInferRequestInternal::StartAsyncWithPriority(const TaskPriority& priority) {
+    _taskPriority = priority;
+    StartAsync();
+}
+
 void IInferRequestInternal::StartAsyncImpl() {
     IE_THROW(NotImplemented);
 }
@@ -4,6 +4,9 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
@@ -19,6 +22,7 @@
 #include "ie_system_conf.h"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
+#include "threading/ie_lock_free_task_queue.hpp"
 #include <openvino/itt.hpp>
 
 using namespace openvino;
@@ -194,18 +198,27 @@ struct CPUStreamsExecutor::Impl {
             }
         }
         #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new LockFreeTaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                int prioritizedInRow = 0;
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    // Spin for a while before parking: for short tasks the next one usually comes before the thread
+                    // would be woken up by the condition variable
+                    for (int spin = 0; !PopTask(streamId, task, prioritizedInRow) && spin < spinCount; ++spin) {
+                        std::this_thread::yield();
+                    }
+                    if (!task) {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                        ++_parkedThreads;
+                        // pairs with the fence in WakeUpParkedThread(): either the producer sees the parked thread or the thread sees the task
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        _queueCondVar.wait(lock, [&] { return HasTasks() || (stopped = _isStopped); });
+                        --_parkedThreads;
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
@@ -216,11 +229,136 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        auto queueId = _nextTaskQueue.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size();
+        if (!_taskQueues[queueId]->TryPush(task)) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace(std::move(task));
+            _overflowSize.store(_overflowQueue.size());
+        }
+        WakeUpParkedThread();
+    }
+
+    void EnqueueWithPriority(Task task, const TaskPriority& priority) {
+        if (priority._priority == 0 && priority._deadline == TaskPriority::Clock::time_point::max()) {
+            // default class goes to the lock-free queues as is, its queueing delay is not accounted
+            Enqueue(std::move(task));
+            return;
+        }
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            std::lock_guard<std::mutex> lock(_priorityMutex);
+            _prioritizedTasks.push_back({std::move(task), priority, TaskPriority::Clock::now(), _prioritizedTasksOrder++});
+            _prioritizedTasksSize.store(_prioritizedTasks.size());
+        }
+        WakeUpParkedThread();
+    }
+
+    void WakeUpParkedThread() {
+        // pairs with the fence in the thread loop: either the producer sees the parked thread or the thread sees the task
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_parkedThreads.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    void UpdateStatistics(const int priority, const TaskPriority::Clock::time_point enqueueTime) {
+        const auto delayMs = std::chrono::duration<double, std::milli>(TaskPriority::Clock::now() - enqueueTime).count();
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        auto& statistics = _queueingStatistics[priority];
+        statistics._tasks++;
+        statistics._totalDelayMs += delayMs;
+        statistics._maxDelayMs = std::max(statistics._maxDelayMs, delayMs);
+    }
+
+    bool HasTasks() const {
+        if (_overflowSize.load() > 0 || _prioritizedTasksSize.load() > 0) {
+            return true;
+        }
+        for (auto&& taskQueue : _taskQueues) {
+            if (!taskQueue->Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Tasks with positive priority or a deadline go ahead of the default ones, but each fairnessWindow-th task is taken
+    // from the default queues if they are not empty, so the default class is not starved
+    bool PopTask(const int queueId, Task& task, int& prioritizedInRow) {
+        if (_prioritizedTasksSize.load() > 0 && prioritizedInRow < fairnessWindow && PopPrioritizedTask(task, true)) {
+            prioritizedInRow++;
+            return true;
+        }
+        if (PopDefaultTask(queueId, task)) {
+            prioritizedInRow = 0;
+            return true;
+        }
+        return _prioritizedTasksSize.load() > 0 && PopPrioritizedTask(task, false);
+    }
+
+    // Waiting tasks get their priority raised by one each priorityAgingIntervalMs, so low priority tasks are not starved
+    bool PopPrioritizedTask(Task& task, const bool aheadOfDefaultOnly) {
+        std::unique_lock<std::mutex> lock(_priorityMutex);
+        if (_prioritizedTasks.empty()) {
+            return false;
+        }
+        const auto now = TaskPriority::Clock::now();
+        auto effectivePriority = [&] (const PrioritizedTask& prioritizedTask) {
+            const auto waitingMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - prioritizedTask._enqueueTime).count();
+            return prioritizedTask._priority._priority + static_cast<int>(waitingMs / priorityAgingIntervalMs);
+        };
+        auto best = std::min_element(_prioritizedTasks.begin(), _prioritizedTasks.end(),
+            [&] (const PrioritizedTask& lhs, const PrioritizedTask& rhs) {
+                const auto lhsPriority = effectivePriority(lhs);
+                const auto rhsPriority = effectivePriority(rhs);
+                if (lhsPriority != rhsPriority) {
+                    return lhsPriority > rhsPriority;
+                }
+                if (lhs._priority._deadline != rhs._priority._deadline) {
+                    return lhs._priority._deadline < rhs._priority._deadline;
+                }
+                return lhs._order < rhs._order;
+            });
+        const auto bestPriority = effectivePriority(*best);
+        if (aheadOfDefaultOnly && bestPriority < 0) {
+            return false;
+        }
+        if (aheadOfDefaultOnly && bestPriority == 0 && best->_priority._deadline == TaskPriority::Clock::time_point::max()) {
+            return false;
+        }
+        task = std::move(best->_task);
+        const auto priority = best->_priority._priority;
+        const auto enqueueTime = best->_enqueueTime;
+        _prioritizedTasks.erase(best);
+        _prioritizedTasksSize.store(_prioritizedTasks.size());
+        lock.unlock();
+        UpdateStatistics(priority, enqueueTime);
+        return true;
+    }
+
+    // The own queue of the thread is checked first, then the overflow queue and then tasks are stolen from other streams
+    bool PopDefaultTask(const int queueId, Task& task) {
+        if (_taskQueues[queueId]->TryPop(task)) {
+            return true;
+        }
+        if (_overflowSize.load() > 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_overflowQueue.empty()) {
+                task = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                _overflowSize.store(_overflowQueue.size());
+                return true;
+            }
+        }
+        const auto queuesNum = _taskQueues.size();
+        for (std::size_t i = 1; i < queuesNum; ++i) {
+            if (_taskQueues[(queueId + i) % queuesNum]->TryPop(task)) {
+                return true;
+            }
         }
-        _queueCondVar.notify_one();
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -256,9 +394,33 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    static constexpr std::size_t            taskQueueCapacity = 1024;
+    static constexpr int                    spinCount = 256;
+    std::vector<std::unique_ptr<LockFreeTaskQueue>> _taskQueues;
+    std::atomic<std::size_t>                _nextTaskQueue = {0};
+    // takes tasks which don't fit into the full lock-free queues
+    std::mutex                              _overflowMutex;
+    std::queue<Task>                        _overflowQueue;
+    std::atomic<std::size_t>                _overflowSize = {0};
+    // tasks with non-default priority or deadline
+    struct PrioritizedTask {
+        Task                                _task;
+        TaskPriority                        _priority;
+        TaskPriority::Clock::time_point     _enqueueTime;
+        std::size_t                         _order;
+    };
+    static constexpr int                    fairnessWindow = 8;
+    static constexpr int                    priorityAgingIntervalMs = 100;
+    std::mutex                              _priorityMutex;
+    std::vector<PrioritizedTask>            _prioritizedTasks;
+    std::atomic<std::size_t>                _prioritizedTasksSize = {0};
+    std::size_t                             _prioritizedTasksOrder = 0;
+    std::mutex                              _statisticsMutex;
+    std::map<int, QueueingStatistics>       _queueingStatistics;
+    // idle threads are parked on the condition variable
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::atomic<int>                        _parkedThreads = {0};
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -312,4 +474,17 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::runWithPriority(Task task, const TaskPriority& priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->EnqueueWithPriority(std::move(task), priority);
+    }
+}
+
+std::map<int, CPUStreamsExecutor::QueueingStatistics> CPUStreamsExecutor::GetQueueingStatistics() const {
+    std::lock_guard<std::mutex> lock(_impl->_statisticsMutex);
+    return _impl->_queueingStatistics;
+}
+
 }  // namespace InferenceEngine
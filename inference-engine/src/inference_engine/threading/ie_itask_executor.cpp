@@ -31,4 +31,8 @@ void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
         future.get();
     }
 }
+
+void ITaskExecutor::runWithPriority(Task task, const TaskPriority&) {
+    run(std::move(task));
+}
 }  // namespace InferenceEngine
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue of tasks
+ *
+ * @file ie_lock_free_task_queue.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "threading/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Bounded lock-free queue based on the ring buffer with per-cell sequence numbers (D. Vyukov's MPMC queue).
+ * Any thread can push a task and any thread can pop it, so the queue of one stream is used by other streams to steal work.
+ */
+class LockFreeTaskQueue {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity maximal number of tasks in the queue, must be a power of two
+     */
+    explicit LockFreeTaskQueue(std::size_t capacity) :
+        _cells{new Cell[capacity]},
+        _mask{capacity - 1} {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Pushes the task to the queue
+     * @param task The task, it is moved out only if the push succeeded
+     * @return false if the queue is full
+     */
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueue._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue._value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the oldest task from the queue
+     * @param task The popped task
+     * @return false if the queue is empty
+     */
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeue._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeue._value.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks whether the queue has tasks. The result is approximate if other threads use the queue concurrently
+     * @return true if there are no tasks
+     */
+    bool Empty() const {
+        return _dequeue._value.load() >= _enqueue._value.load();
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        Task                        _task;
+    };
+
+    // positions are modified by producers and consumers independently, so they are kept on separate cache lines
+    struct Position {
+        char                        _padBefore[64];
+        std::atomic<std::size_t>    _value = {0};
+        char                        _padAfter[64 - sizeof(std::size_t)];
+    };
+
+    std::unique_ptr<Cell[]>     _cells;
+    const std::size_t           _mask;
+    Position                    _enqueue;
+    Position                    _dequeue;
+};
+
+}  // namespace InferenceEngine
@@ -25,7 +25,10 @@ public:
     void validate_and_infer_types() override;
     bool visit_attributes(AttributeVisitor& visitor) override;
     int64_t get_axis() const { return m_axis; }
-    void set_axis(int64_t axis) { m_axis = axis; }
+    void set_axis(int64_t axis) {
+        m_axis = axis;
+        mark_for_revalidation();
+    }
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
 
 protected:
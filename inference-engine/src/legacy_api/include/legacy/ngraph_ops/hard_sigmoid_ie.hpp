@@ -30,9 +30,15 @@ public:
     bool visit_attributes(AttributeVisitor& visitor) override;
 
     float get_alpha() const { return m_alpha; }
-    void set_alpha(float alpha) { m_alpha = alpha; }
+    void set_alpha(float alpha) {
+        m_alpha = alpha;
+        mark_for_revalidation();
+    }
     float get_beta() const { return m_beta; }
-    void set_beta(float beta) { m_beta = beta; }
+    void set_beta(float beta) {
+        m_beta = beta;
+        mark_for_revalidation();
+    }
 
 protected:
     float m_alpha;
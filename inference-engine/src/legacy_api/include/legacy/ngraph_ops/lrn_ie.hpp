@@ -33,15 +33,30 @@ public:
     bool visit_attributes(AttributeVisitor& visitor) override;
 
     double get_alpha() const { return m_alpha; }
-    void set_alpha(double alpha) { m_alpha = alpha; }
+    void set_alpha(double alpha) {
+        m_alpha = alpha;
+        mark_for_revalidation();
+    }
     double get_beta() const { return m_beta; }
-    void set_beta(double beta) { m_beta = beta; }
+    void set_beta(double beta) {
+        m_beta = beta;
+        mark_for_revalidation();
+    }
     double get_bias() const { return m_bias; }
-    void set_bias(double bias) { m_bias = bias; }
+    void set_bias(double bias) {
+        m_bias = bias;
+        mark_for_revalidation();
+    }
     size_t get_nsize() const { return m_size; }
-    void set_nsize(size_t size) { m_size = size; }
+    void set_nsize(size_t size) {
+        m_size = size;
+        mark_for_revalidation();
+    }
     std::string get_region() const { return m_region; }
-    void set_region(std::string region) { m_region = region; }
+    void set_region(std::string region) {
+        m_region = region;
+        mark_for_revalidation();
+    }
 
 protected:
     double m_alpha;
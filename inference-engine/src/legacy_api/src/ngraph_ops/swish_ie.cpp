@@ -36,6 +36,7 @@ void op::SwishIE::validate_and_infer_types() {
 
 void op::SwishIE::set_alpha(float alpha)  {
     m_alpha = alpha;
+    mark_for_revalidation();
 }
 
 float op::SwishIE::get_alpha() const {
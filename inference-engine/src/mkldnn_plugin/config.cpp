@@ -82,6 +82,62 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES) hugePages = true;
+            else if (val == PluginConfigParams::NO) hugePages = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val == PluginConfigParams::CPU_WEIGHTS_FP16) weightsCompression = WeightsCompression::FP16;
+            else if (val == PluginConfigParams::CPU_WEIGHTS_INT8) weightsCompression = WeightsCompression::INT8;
+            else if (val == PluginConfigParams::NO) weightsCompression = WeightsCompression::Off;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                                   << ". Expected only " << PluginConfigParams::CPU_WEIGHTS_FP16 << "/"
+                                   << PluginConfigParams::CPU_WEIGHTS_INT8 << "/" << PluginConfigParams::NO;
+        } else if (key == PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS) {
+            if (val == PluginConfigParams::CPU_CONSTANTS_BACKGROUND) deferredConstants = DeferredConstants::Background;
+            else if (val == PluginConfigParams::CPU_CONSTANTS_ON_FIRST_INFER) deferredConstants = DeferredConstants::FirstInfer;
+            else if (val == PluginConfigParams::NO) deferredConstants = DeferredConstants::Off;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS
+                                   << ". Expected only " << PluginConfigParams::CPU_CONSTANTS_BACKGROUND << "/"
+                                   << PluginConfigParams::CPU_CONSTANTS_ON_FIRST_INFER << "/" << PluginConfigParams::NO;
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_BUDGET_MB) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_BUDGET_MB
+                                    << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_BUDGET_MB
+                                    << ". Expected only non negative integer numbers";
+            memoryBudgetMb = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE) {
+            if (val == PluginConfigParams::CPU_AUTO_TUNE_THROUGHPUT) autoTuneMode = AutoTuneMode::Throughput;
+            else if (val == PluginConfigParams::CPU_AUTO_TUNE_LATENCY) autoTuneMode = AutoTuneMode::Latency;
+            else if (val == PluginConfigParams::NO) autoTuneMode = AutoTuneMode::Off;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE
+                                   << ". Expected only " << PluginConfigParams::CPU_AUTO_TUNE_THROUGHPUT << "/"
+                                   << PluginConfigParams::CPU_AUTO_TUNE_LATENCY << "/" << PluginConfigParams::NO;
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_TUNE_TIME_BUDGET_MS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_TUNE_TIME_BUDGET_MS
+                                    << ". Expected only positive integer numbers";
+            }
+            if (val_i <= 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_TUNE_TIME_BUDGET_MS
+                                    << ". Expected only positive integer numbers";
+            autoTuneTimeBudgetMs = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_TUNE_CACHE_DIR) {
+            autoTuneCacheDir = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -150,6 +206,51 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (hugePages == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
+
+        switch (weightsCompression) {
+            case WeightsCompression::Off:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::NO });
+            break;
+            case WeightsCompression::FP16:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::CPU_WEIGHTS_FP16 });
+            break;
+            case WeightsCompression::INT8:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::CPU_WEIGHTS_INT8 });
+            break;
+        }
+
+        _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_BUDGET_MB, std::to_string(memoryBudgetMb) });
+
+        switch (deferredConstants) {
+            case DeferredConstants::Off:
+                _config.insert({ PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::NO });
+            break;
+            case DeferredConstants::Background:
+                _config.insert({ PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::CPU_CONSTANTS_BACKGROUND });
+            break;
+            case DeferredConstants::FirstInfer:
+                _config.insert({ PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::CPU_CONSTANTS_ON_FIRST_INFER });
+            break;
+        }
+
+        switch (autoTuneMode) {
+            case AutoTuneMode::Off:
+                _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE, PluginConfigParams::NO });
+            break;
+            case AutoTuneMode::Throughput:
+                _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE, PluginConfigParams::CPU_AUTO_TUNE_THROUGHPUT });
+            break;
+            case AutoTuneMode::Latency:
+                _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE, PluginConfigParams::CPU_AUTO_TUNE_LATENCY });
+            break;
+        }
+        _config.insert({ PluginConfigParams::KEY_CPU_AUTO_TUNE_TIME_BUDGET_MS, std::to_string(autoTuneTimeBudgetMs) });
+        _config.insert({ PluginConfigParams::KEY_CPU_AUTO_TUNE_CACHE_DIR, autoTuneCacheDir });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
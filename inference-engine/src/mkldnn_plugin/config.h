@@ -18,9 +18,34 @@ struct Config {
         On,
     };
 
+    enum class AutoTuneMode {
+        Off,
+        Throughput,
+        Latency,
+    };
+
+    enum class WeightsCompression {
+        Off,
+        FP16,
+        INT8,
+    };
+
+    enum class DeferredConstants {
+        Off,
+        Background,
+        FirstInfer,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool hugePages = false;
+    WeightsCompression weightsCompression = WeightsCompression::Off;
+    int memoryBudgetMb = 0;
+    DeferredConstants deferredConstants = DeferredConstants::Off;
+    AutoTuneMode autoTuneMode = AutoTuneMode::Off;
+    int autoTuneTimeBudgetMs = 2000;
+    std::string autoTuneCacheDir = "";
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
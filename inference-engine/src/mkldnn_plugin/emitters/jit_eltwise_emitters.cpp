@@ -1317,6 +1317,10 @@ jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_
 
     prepare_table();
 }
+jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_t host_isa, float power, float scale, float shift, Precision exec_prc)
+: jit_emitter(host, host_isa, static_cast<const MKLDNNNode*>(nullptr), exec_prc), power(power), scale(scale), shift(shift) {
+    prepare_table();
+}
 
 size_t jit_power_static_emitter::get_inputs_num() const { return 1; }
 
@@ -28,6 +28,8 @@ protected:
                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
     jit_mkldnn_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+    jit_mkldnn_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                       mkldnn_alg_kind_t algKind, float alpha, float beta, InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
     void set_injector();
 
     mkldnn_alg_kind_t kind {mkldnn_alg_kind_undef};
@@ -47,6 +49,8 @@ class jit_mkldnn_aux_emitter : public jit_mkldnn_emitter {
 public:
     jit_mkldnn_aux_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const MKLDNNNode* node,
                            InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+    jit_mkldnn_aux_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                           mkldnn_alg_kind_t algKind, float alpha, float beta, InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
 
 private:
 };
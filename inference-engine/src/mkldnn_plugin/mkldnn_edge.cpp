@@ -145,7 +145,7 @@ int MKLDNNEdge::getOutputNum() {
     return child_port;
 }
 
-void MKLDNNEdge::allocate(const void* mem_ptr) {
+void MKLDNNEdge::allocate(const void* mem_ptr, bool useHugePages, int numaNodeId) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -164,7 +164,10 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
 
     auto parentPtr = getParent();
     memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
-    memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr, false);  // no pads zeroing
+    if (mem_ptr == nullptr && useHugePages)
+        memoryPtr->CreateWithHugePages(MKLDNNMemoryDesc(inputDesc), numaNodeId);
+    else
+        memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr, false);  // no pads zeroing
     status = Status::Allocated;
 }
 
@@ -193,13 +196,13 @@ std::string MKLDNNEdge::name() {
             + "<->" + childPtr->getName() + std::to_string(child_port);
 }
 
-void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
+void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, bool useHugePages, int numaNodeId) {
     if (status != Status::NeedAllocation)
         return;
 
     if (weightsCache) {
-        auto alloc = [this] () {
-            allocate();
+        auto alloc = [this, useHugePages, numaNodeId] () {
+            allocate(nullptr, useHugePages, numaNodeId);
             return memoryPtr;
         };
 
@@ -208,7 +211,7 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
         externalMemoryPtr = true;
         status = Status::Allocated;
     } else {
-        allocate();
+        allocate(nullptr, useHugePages, numaNodeId);
     }
 }
 
@@ -45,8 +45,8 @@ public:
     void changeStatus(Status state);
 
     void init();
-    void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
+    void allocate(const void* mem_ptr = nullptr, bool useHugePages = false, int numaNodeId = -1);
+    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, bool useHugePages = false, int numaNodeId = -1);
     void validate();
     void drop();
 
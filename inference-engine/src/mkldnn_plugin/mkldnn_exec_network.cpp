@@ -12,6 +12,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "mkldnn_streams_auto_tuner.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
@@ -22,13 +23,65 @@
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
+#include <cmath>
 #include <cstring>
+#include <sstream>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+// Replaces the FP32 weights of a FullyConnected layer with the FP16 ones or with the INT8 ones and a scale per output
+// channel, MKLDNNFullyConnectedNode runs the kernel which decompresses them in registers for such weights
+void compressFullyConnectedWeights(FullyConnectedLayer& layer, Config::WeightsCompression compression) {
+    const Blob::Ptr weights = layer._weights;
+    if (weights == nullptr || weights->getTensorDesc().getPrecision() != Precision::FP32 || layer.insData.size() != 1)
+        return;
+    if (layer.insData[0].lock()->getPrecision() != Precision::FP32 || layer.outData[0]->getPrecision() != Precision::FP32)
+        return;
+
+    const size_t outputs = layer.outData[0]->getTensorDesc().getDims().back();
+    if (outputs == 0 || weights->size() % outputs != 0)
+        return;
+    const size_t inputs = weights->size() / outputs;
+    const float* src = weights->cbuffer().as<const float*>();
+    const TensorDesc& desc = weights->getTensorDesc();
+
+    Blob::Ptr compressed;
+    if (compression == Config::WeightsCompression::FP16) {
+        compressed = make_shared_blob<ie_fp16>(TensorDesc(Precision::FP16, desc.getDims(), desc.getLayout()));
+        compressed->allocate();
+        PrecisionUtils::f32tof16Arrays(compressed->buffer().as<ie_fp16*>(), src, weights->size());
+    } else {
+        auto scales = make_shared_blob<float>(TensorDesc(Precision::FP32, {outputs}, Layout::C));
+        scales->allocate();
+        compressed = make_shared_blob<int8_t>(TensorDesc(Precision::I8, desc.getDims(), desc.getLayout()));
+        compressed->allocate();
+
+        // symmetric quantization keeps the zero of every output channel exact
+        float* scalesData = scales->buffer().as<float*>();
+        int8_t* dst = compressed->buffer().as<int8_t*>();
+        for (size_t o = 0; o < outputs; o++) {
+            const float* row = src + o * inputs;
+            float maxAbs = 0.f;
+            for (size_t i = 0; i < inputs; i++)
+                maxAbs = std::max(maxAbs, std::fabs(row[i]));
+            const float scale = maxAbs > 0.f ? maxAbs / 127.f : 1.f;
+            for (size_t i = 0; i < inputs; i++) {
+                const float q = std::round(row[i] / scale);
+                dst[o * inputs + i] = static_cast<int8_t>(std::max(-127.f, std::min(127.f, q)));
+            }
+            scalesData[o] = scale;
+        }
+        layer.blobs["weights_scales"] = scales;
+    }
+    layer.blobs["weights"] = compressed;
+    layer._weights = compressed;
+}
+}  // namespace
+
 InferenceEngine::IInferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -195,6 +248,12 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                 defConvLayer->blobs.clear();
                 defConvLayer->_weights = nullptr;
             }
+        } else if (layer->type == "FullyConnected" && _cfg.weightsCompression != Config::WeightsCompression::Off) {
+            auto * fcLayer = dynamic_cast<FullyConnectedLayer*>(layer.get());
+            if (fcLayer == nullptr)
+                IE_THROW() << "Cannot convert fully connected layer.";
+
+            compressFullyConnectedWeights(*fcLayer, _cfg.weightsCompression);
         } else if (layer->type == "BinaryConvolution") {
             auto * binConvLayer = dynamic_cast<BinaryConvolutionLayer*>(layer.get());
             if (binConvLayer == nullptr)
@@ -235,10 +294,21 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
+        // zero streams means the user threads run the inference, so there is nothing to tune
+        if (_cfg.autoTuneMode != Config::AutoTuneMode::Off && _cfg.streamExecutorConfig._streams != 0) {
+            OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "autoTuneStreams");
+            streamsExecutorConfig = autoTuneStreams(_clonedNetwork, _cfg, extensionManager, streamsExecutorConfig);
+            _cfg.streamExecutorConfig._streams = streamsExecutorConfig._streams;
+            _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
+            _cfg.streamExecutorConfig._threadsPerStream = streamsExecutorConfig._threadsPerStream;
+            _cfg.streamExecutorConfig._threadBindingType = streamsExecutorConfig._threadBindingType;
+            _cfg._config.clear();
+            _cfg.updateProperties();
+        }
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
+    if (0 != _cfg.streamExecutorConfig._streams) {
         _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
     } else {
@@ -248,6 +318,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    for (auto numaNode : getAvailableNUMANodes())
+        _graphTemplates[numaNode];
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
             task = [this] {
@@ -293,12 +365,30 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
-                auto localNetwork = cloneNetwork(_clonedNetwork);
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+                auto createGraph = [&] {
+                    auto localNetwork = cloneNetwork(_clonedNetwork);
+                    graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+                };
+                auto graphTemplate = _graphTemplates.find(numaNodeId);
+                if (graphTemplate == _graphTemplates.end()) {
+                    createGraph();
+                } else {
+                    // the other streams of the NUMA node wait for the first graph, then they only copy it
+                    std::unique_lock<std::mutex> templateLock{graphTemplate->second._mutex};
+                    if (graphTemplate->second._graph == nullptr) {
+                        createGraph();
+                        graphTemplate->second._graph = &graphLock._graph;
+                    } else {
+                        templateLock.unlock();
+                        auto templateGraphLock = Graph::Lock(*graphTemplate->second._graph);
+                        if (!graphLock._graph.CloneGraph(templateGraphLock._graph, _numaNodesWeights[numaNodeId]))
+                            createGraph();
+                    }
+                }
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -364,6 +454,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_NUMA_NODES_PLACEMENT));
+        metrics.push_back(METRIC_KEY(CPU_QUEUEING_DELAY));
+        metrics.push_back(METRIC_KEY(CPU_MEMORY_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -378,6 +471,64 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_NUMA_NODES_PLACEMENT)) {
+        // One line per created stream graph, e.g. "stream 0 (NUMA node 1): weights {1: 25165824}, workspace {1: 3211264}"
+        auto placementToString = [](const std::map<int, size_t>& placement) {
+            std::stringstream ss;
+            ss << "{";
+            for (auto it = placement.begin(); it != placement.end(); ++it)
+                ss << (it == placement.begin() ? "" : ", ") << it->first << ": " << it->second;
+            ss << "}";
+            return ss.str();
+        };
+        std::vector<std::string> placement;
+        int streamId = 0;
+        for (auto& graph : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady()) {
+                std::map<int, size_t> weights, workspace;
+                graphLock._graph.GetNumaPlacement(weights, workspace);
+                placement.push_back("stream " + std::to_string(streamId) +
+                                    " (NUMA node " + std::to_string(graphLock._graph.GetNumaNodeId()) + "): " +
+                                    "weights " + placementToString(weights) + ", workspace " + placementToString(workspace));
+            }
+            streamId++;
+        }
+        IE_SET_METRIC_RETURN(CPU_NUMA_NODES_PLACEMENT, placement);
+    } else if (name == METRIC_KEY(CPU_MEMORY_STATISTICS)) {
+        // One line per created stream graph, e.g. "stream 0: workspace 3211264 bytes, peak live 2408448 bytes,
+        // fragmentation 25%, recomputed 1 tensors (802816 bytes), spilled 0 tensors (0 bytes)"
+        std::vector<std::string> statistics;
+        int streamId = 0;
+        for (auto& graph : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (graphLock._graph.IsReady()) {
+                const auto& memory = graphLock._graph.GetMemoryStatistics();
+                const auto fragmentation = memory.workspaceSize ?
+                        100 * (memory.workspaceSize - memory.peakLiveSize) / memory.workspaceSize : 0;
+                std::stringstream ss;
+                ss << "stream " << streamId << ": workspace " << memory.workspaceSize << " bytes, peak live "
+                   << memory.peakLiveSize << " bytes, fragmentation " << fragmentation << "%, recomputed "
+                   << memory.recomputedTensors << " tensors (" << memory.recomputedSize << " bytes), spilled "
+                   << memory.spilledTensors << " tensors (" << memory.spilledSize << " bytes)";
+                statistics.push_back(ss.str());
+            }
+            streamId++;
+        }
+        IE_SET_METRIC_RETURN(CPU_MEMORY_STATISTICS, statistics);
+    } else if (name == METRIC_KEY(CPU_QUEUEING_DELAY)) {
+        // One line per priority class, e.g. "priority 1: 120 tasks, average 0.35 ms, max 2.1 ms"
+        std::vector<std::string> delays;
+        if (auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor)) {
+            for (auto&& statistics : streamsExecutor->GetQueueingStatistics()) {
+                std::stringstream ss;
+                ss << "priority " << statistics.first << ": " << statistics.second._tasks << " tasks, average "
+                   << (statistics.second._tasks ? statistics.second._totalDelayMs / statistics.second._tasks : 0)
+                   << " ms, max " << statistics.second._maxDelayMs << " ms";
+                delays.push_back(ss.str());
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_QUEUEING_DELAY, delays);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -63,6 +63,12 @@ protected:
     };
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
+    struct GraphTemplate {
+        std::mutex  _mutex;
+        Graph*      _graph = nullptr;
+    };
+    // The first graph compiled on a NUMA node is copied to the other streams of the node instead of compiling them
+    std::map<int, GraphTemplate>                _graphTemplates;
     NumaNodesWeights&                           _numaNodesWeights;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
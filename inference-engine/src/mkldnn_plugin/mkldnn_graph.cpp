@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
+#include <cstdio>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -35,9 +37,12 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <threading/ie_thread_affinity.hpp>
 
 #include "utils/blob_dump.h"
 #include "utils/general_utils.h"
+#include "utils/numa_memory.hpp"
 
 /*****************************************************
  * Debug capability
@@ -103,6 +108,8 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         ForgetGraphData();
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // memory placement matters only if there are several NUMA nodes
+    numaNodeId = w_cache && getAvailableNUMANodes().size() > 1 ? w_cache->getNumaNodeId() : -1;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -114,6 +121,90 @@ template void MKLDNNGraph::CreateGraph(const TensorIterator::Body&,
 template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
         const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
 
+bool MKLDNNGraph::CloneGraph(const MKLDNNGraph &templateGraph, MKLDNNWeightsSharing::Ptr &w_cache) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CloneGraph");
+
+    if (IsReady())
+        ForgetGraphData();
+
+    // the background worker of the template executes its constant nodes, it waits until the template is copied
+    std::unique_lock<std::mutex> templateConstantsLock;
+    if (templateGraph.deferredConstants)
+        templateConstantsLock = std::unique_lock<std::mutex>(templateGraph.deferredConstants->mutex);
+
+    std::unordered_map<MKLDNNNode*, MKLDNNNodePtr> nodesMap;
+    std::vector<MKLDNNNodePtr> nodes;
+    for (auto &node : templateGraph.graphNodes) {
+        auto copy = node->clone();
+        if (!copy)
+            return false;
+        nodesMap[node.get()] = copy;
+        nodes.push_back(copy);
+    }
+
+    std::unordered_map<MKLDNNEdge*, MKLDNNEdgePtr> edgesMap;
+    for (auto &edge : templateGraph.graphEdges) {
+        auto copy = std::make_shared<MKLDNNEdge>(nodesMap[edge->getParent().get()], nodesMap[edge->getChild().get()],
+                                                 edge->getInputNum(), edge->getOutputNum());
+        edgesMap[edge.get()] = copy;
+        graphEdges.push_back(copy);
+    }
+
+    // edges are attached in the original order, since the nodes address them by index
+    auto copyEdges = [&](const std::vector<MKLDNNEdgeWeakPtr> &from, std::vector<MKLDNNEdgeWeakPtr> &to) {
+        for (auto &edge : from) {
+            auto found = edgesMap.find(edge.lock().get());
+            if (found == edgesMap.end())
+                return false;
+            to.push_back(found->second);
+        }
+        return true;
+    };
+    for (auto &node : templateGraph.graphNodes) {
+        auto &copy = nodesMap[node.get()];
+        if (!copyEdges(node->parentEdges, copy->parentEdges) || !copyEdges(node->childEdges, copy->childEdges)) {
+            graphEdges.clear();
+            return false;
+        }
+    }
+
+    graphNodes = nodes;
+    for (auto &input : templateGraph.inputNodes)
+        inputNodes[input.first] = nodesMap[input.second.get()];
+    for (auto &output : templateGraph.outputNodes)
+        outputNodes.push_back(nodesMap[output.get()]);
+    for (auto &output : templateGraph.outputNodesMap)
+        outputNodesMap[output.first] = nodesMap[output.second.get()];
+    _meanImages = templateGraph._meanImages;
+    _name = templateGraph._name;
+    reuse_io_tensors = templateGraph.reuse_io_tensors;
+
+    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    numaNodeId = w_cache && getAvailableNUMANodes().size() > 1 ? w_cache->getNumaNodeId() : -1;
+
+    // the only thing to do for the copy is its own memory: the primitives are bound to it,
+    // the constants are taken from the weights cache or computed once more if there is no cache
+    Allocate();
+
+    std::unordered_map<void*, MKLDNNMemoryPtr> memoryMap;
+    for (auto &edge : templateGraph.graphEdges) {
+        auto &copy = edgesMap[edge.get()];
+        memoryMap[edge->getMemoryPtr()->GetPrimitive().get_data_handle()] = copy->getMemoryPtr();
+    }
+    for (auto &node : graphNodes)
+        node->rebindMemory(memoryMap);
+    if (templateConstantsLock.owns_lock())
+        templateConstantsLock.unlock();
+
+    stream = mkldnn::stream(eng);
+
+    BindConstantsToNumaNode();
+
+    ExecuteConstantNodesOnly();
+    status = Ready;
+    return true;
+}
+
 void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
     this->reuse_io_tensors = false;
@@ -360,8 +451,17 @@ void MKLDNNGraph::InitGraph() {
 
     CreatePrimitives();
 
+    BindConstantsToNumaNode();
+
     SetOriginalLayerNames();
 
+    for (auto &node : outputNodes) {
+        // remove out_ from node name
+        outputNodesMap[node->getName().substr(4)] = node;
+    }
+
+    stream = mkldnn::stream(eng);
+
     if (!config.dumpToDot.empty())
         dumpToDotFile(config.dumpToDot + "_init.dot");
 
@@ -457,51 +557,162 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
-void MKLDNNGraph::ExecuteConstantNodesOnly() {
-    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
-    mkldnn::stream stream(eng);
-
+void MKLDNNGraph::ExecuteConstantNode(const MKLDNNNodePtr& node, mkldnn::stream& strm) {
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
 
-    auto acquireSharedOutputs = [this](MKLDNNNodePtr & graphNode) {
-        std::vector<shared_memory_ptr> outputs;
-        bool hasLocalAllocatedEdges = false;
-        bool hasExternalInvalidEdges = false;
-
-        for (size_t i = 0; i < graphNode->getChildEdges().size(); ++i) {
-            auto edgePtr = graphNode->getChildEdgeAt(i);
-            if (edgePtr) {
-                if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
-                    outputs.emplace_back(ptr);
-                    if (!ptr->isValid())
-                        hasExternalInvalidEdges = true;
-                } else {
-                    hasLocalAllocatedEdges = true;
-                }
+    if (!weightsCache) {
+        node->execute(strm);
+        return;
+    }
+
+    std::vector<shared_memory_ptr> outputs;
+    bool hasLocalAllocatedEdges = false;
+    bool hasExternalInvalidEdges = false;
+
+    for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+        auto edgePtr = node->getChildEdgeAt(i);
+        if (edgePtr) {
+            if (edgePtr->isUseExternalMemory()) {
+                auto ptr = weightsCache->get(edgePtr->name());
+                outputs.emplace_back(ptr);
+                if (!ptr->isValid())
+                    hasExternalInvalidEdges = true;
+            } else {
+                hasLocalAllocatedEdges = true;
             }
         }
+    }
 
-        return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
-    };
+    if (hasExternalInvalidEdges || hasLocalAllocatedEdges) {
+        node->execute(strm);
+
+        for (auto & output : outputs)
+            output->valid(true);
+    }
+}
+
+void MKLDNNGraph::ExecuteConstantNodesOnly() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
+
+    if (config.deferredConstants != Config::DeferredConstants::Off) {
+        DeferConstantNodes();
+        return;
+    }
 
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
             continue;
 
-        if (weightsCache) {
-            auto sharedOutputs = acquireSharedOutputs(graphNode);
+        ExecuteConstantNode(graphNode, stream);
+    }
+}
+
+void MKLDNNGraph::DeferConstantNodes() {
+    std::unique_ptr<DeferredConstants> deferred(new DeferredConstants());
 
-            if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                graphNode->execute(stream);
+    std::unordered_map<MKLDNNNode*, size_t> positions;
+    for (auto &graphNode : graphNodes) {
+        if (!graphNode->isConstant())
+            continue;
+        deferred->nodes.push_back(graphNode);
+        positions[graphNode.get()] = deferred->nodes.size();
+    }
+    if (deferred->nodes.empty())
+        return;
 
-                for (auto & output : std::get<2>(sharedOutputs))
-                    output->valid(true);
+    // the constant nodes are in the execution order, so a node needs the prefix up to its last constant parent
+    deferred->required.resize(graphNodes.size(), 0);
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (graphNodes[i]->isConstant())
+            continue;
+        for (size_t j = 0; j < graphNodes[i]->getParentEdges().size(); j++) {
+            auto found = positions.find(graphNodes[i]->getParentEdgeAt(j)->getParent().get());
+            if (found != positions.end())
+                deferred->required[i] = std::max(deferred->required[i], found->second);
+        }
+    }
+
+    deferred->stream = mkldnn::stream(eng);
+
+    if (config.deferredConstants == Config::DeferredConstants::Background) {
+        auto worker = deferred.get();
+        deferred->worker = std::thread([this, worker] {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::PrepareConstants");
+            // the worker is started outside of the streams, so it is kept on the NUMA node of the graph's stream
+            if (numaNodeId >= 0)
+                PinCurrentThreadToSocket(numaNodeId);
+            // one node at a time, so an inference waits only for the node being executed
+            for (size_t count = 1; count <= worker->nodes.size() && !worker->cancelled; count++) {
+                try {
+                    PrepareConstants(*worker, count);
+                } catch (...) {
+                    // the error is kept and rethrown by the inference
+                    return;
+                }
             }
-        } else {
-            graphNode->execute(stream);
+        });
+    }
+    deferredConstants = std::move(deferred);
+}
+
+void MKLDNNGraph::PrepareConstants(DeferredConstants& deferred, size_t count) {
+    std::lock_guard<std::mutex> lock(deferred.mutex);
+    if (deferred.error)
+        std::rethrow_exception(deferred.error);
+
+    try {
+        for (; deferred.prepared < count; deferred.prepared++)
+            ExecuteConstantNode(deferred.nodes[deferred.prepared], deferred.stream);
+    } catch (...) {
+        deferred.error = std::current_exception();
+        throw;
+    }
+    if (deferred.prepared == deferred.nodes.size())
+        deferred.done = true;
+}
+
+std::vector<MKLDNNMemoryPtr> MKLDNNGraph::GetConstantMemory() {
+    std::vector<MKLDNNMemoryPtr> constants;
+    std::unordered_set<void*> visited;
+    auto collect = [&](const MKLDNNMemoryPtr& memory) {
+        if (memory && memory->GetData() && visited.insert(memory->GetData()).second)
+            constants.push_back(memory);
+    };
+
+    for (auto &graphNode : graphNodes) {
+        for (auto &memory : graphNode->internalBlobMemory)
+            collect(memory);
+        if (!graphNode->isConstant())
+            continue;
+        for (size_t i = 0; i < graphNode->getChildEdges().size(); i++) {
+            auto edge = graphNode->getChildEdgeAt(i);
+            if (edge && edge->getStatus() == MKLDNNEdge::Status::Allocated)
+                collect(edge->getMemoryPtr());
         }
     }
+    return constants;
+}
+
+void MKLDNNGraph::BindConstantsToNumaNode() {
+    if (numaNodeId < 0)
+        return;
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "BindConstantsToNumaNode");
+    // Internal blobs are already reordered at this point, so their pages are migrated to the node.
+    // Constant edges are filled later by ExecuteConstantNodesOnly() or by the deferred constants worker,
+    // the binding places their pages on the node whichever thread touches them first.
+    for (auto &memory : GetConstantMemory()) {
+        // huge pages are placed by the allocation
+        if (!memory->IsHugePagesBacked())
+            bindToNumaNode(memory->GetData(), memory->GetSize(), numaNodeId);
+    }
+}
+
+void MKLDNNGraph::GetNumaPlacement(std::map<int, size_t>& weights, std::map<int, size_t>& workspace) {
+    for (auto &memory : GetConstantMemory())
+        getNumaPlacement(memory->GetData(), memory->GetSize(), weights);
+    if (memWorkspace)
+        getNumaPlacement(memWorkspace->GetData(), memWorkspace->GetSize(), workspace);
 }
 
 static bool isReorderAvailable(const TensorDesc& parentDesc, const TensorDesc& childDesc, const mkldnn::engine& eng) {
@@ -624,7 +835,154 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+namespace {
+// Possible release of a tensor for the longest interval between its uses
+struct TensorRelease {
+    size_t cluster;
+    MemorySolver::Gap gap;
+    // the node to execute again before the next use, the data is spilled if it is not set
+    MKLDNNNodePtr producer;
+    std::vector<size_t> recomputeInputs;
+    int64_t score;
+};
+
+// Producers which recomputation is cheaper than keeping their output for a long time
+bool isCheapToRecompute(const MKLDNNNodePtr& node) {
+    return one_of(node->getType(), Eltwise, Reorder, Convert);
+}
+}  // namespace
+
+// Collects the tensors which are not needed for some time between their uses, the most profitable ones go first.
+// Only the tensors written by a single output port and not shared with other tensors in-place are considered.
+static std::vector<TensorRelease> findTensorReleases(const edge_clusters_t& edge_clusters,
+                                                     const std::vector<MemorySolver::Box>& boxes,
+                                                     const std::vector<bool>& ioOrConst) {
+    std::unordered_map<MKLDNNEdgePtr, size_t> clusterOf;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        for (auto &edge : edge_clusters[i])
+            clusterOf[edge] = i;
+    }
+
+    auto isPlain = [&](size_t cluster) {
+        auto first = *edge_clusters[cluster].begin();
+        for (auto &edge : edge_clusters[cluster]) {
+            if (edge->getParent() != first->getParent() || edge->getInputNum() != first->getInputNum())
+                return false;
+        }
+        // all the outputs of the producer, so its execution writes nothing else
+        return first->getParent()->getChildEdges().size() == edge_clusters[cluster].size();
+    };
+
+    std::vector<TensorRelease> releases;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        if (ioOrConst[i] || !isPlain(i))
+            continue;
+
+        std::vector<int> uses;
+        for (auto &edge : edge_clusters[i])
+            uses.push_back(edge->getChild()->execIndex);
+        std::sort(uses.begin(), uses.end());
+
+        int previous = boxes[i].start;
+        TensorRelease release = {i, {static_cast<int64_t>(i), 0, -1}, nullptr, {}, 0};
+        for (int use : uses) {
+            if (use - previous - 1 > release.gap.finish - release.gap.start + 1)
+                release.gap = {static_cast<int64_t>(i), previous + 1, use - 1};
+            previous = use;
+        }
+        if (release.gap.finish < release.gap.start)
+            continue;
+        release.score = boxes[i].size * (release.gap.finish - release.gap.start + 1);
+
+        auto producer = (*edge_clusters[i].begin())->getParent();
+        bool canRecompute = isCheapToRecompute(producer);
+        for (size_t j = 0; canRecompute && j < producer->getParentEdges().size(); j++) {
+            auto input = producer->getParentEdgeAt(j);
+            if (input->getParent()->isConstant())
+                continue;
+            auto cluster = clusterOf.find(input);
+            // the input has to stay untouched till the recomputation
+            canRecompute = cluster != clusterOf.end() && isPlain(cluster->second) &&
+                           (boxes[cluster->second].finish == -1 || boxes[cluster->second].finish > release.gap.finish);
+            if (canRecompute)
+                release.recomputeInputs.push_back(cluster->second);
+        }
+        if (canRecompute)
+            release.producer = producer;
+        releases.push_back(release);
+    }
+
+    // recomputation costs less than the file I/O, so such tensors are released first
+    std::sort(releases.begin(), releases.end(), [](const TensorRelease& l, const TensorRelease& r) {
+        if (static_cast<bool>(l.producer) != static_cast<bool>(r.producer))
+            return static_cast<bool>(l.producer);
+        return l.score > r.score;
+    });
+    return releases;
+}
+
+// Bytes from the beginning of the edge data to the end of its last element
+static int64_t getEdgeMemorySize(const MKLDNNEdgePtr& edge) {
+    const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
+
+    int64_t e_size = block_desk.getOffsetPadding() + 1;  // size in elements (from begin of data to last element)
+    for (int j = 0; j < block_desk.getBlockDims().size(); j++)
+        e_size += (block_desk.getBlockDims()[j] - 1) * block_desk.getStrides()[j];
+
+    // In some cases computational formula above doesn't work properly (e.g. for OhIw8o4i layout).
+    // This WA allows to limit the size of allocated memory from below.
+    // TODO: need to properly investigate the root cause of incorrect computations
+    int64_t min_size = 1;
+    for (int64_t dim : block_desk.getBlockDims()) {
+        min_size *= dim;
+    }
+    e_size = std::max(e_size, min_size);
+
+    // BIN data are packed by 8 channels per byte, each spatial point starts from a new byte
+    if (edge->getDesc().getPrecision() == Precision::BIN) {
+        int64_t channels = 1;
+        for (int j = 0; j < block_desk.getBlockDims().size(); j++) {
+            if (block_desk.getOrder()[j] == 1)
+                channels *= block_desk.getBlockDims()[j];
+        }
+        return div_up(e_size, channels) * div_up(channels, 8);
+    }
+    return e_size * edge->getDesc().getPrecision().size();
+}
+
+// Writes the lifetime and the placement of each workspace tensor as CSV, timestamps are the node exec indices.
+// Released tensors have the interval they don't keep their memory in the gap columns.
+static void dumpMemoryTimeline(const std::string& file, const edge_clusters_t& edge_clusters,
+                               const std::vector<MemorySolver::Box>& boxes, const MemorySolver& solver,
+                               const std::vector<MemorySolver::Gap>& gaps, int64_t alignment) {
+    std::ofstream csv(file);
+    if (!csv.is_open()) IE_THROW() << "CPU Plugin cannot create memory timeline file " << file << ".";
+
+    csv << "cluster,edges,start,finish,size,offset,gap_start,gap_finish\n";
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        std::string edges;
+        for (auto &edge : edge_clusters[i]) {
+            if (!edges.empty()) edges += " ";
+            edges += edge->getParent()->getName() + "->" + edge->getChild()->getName();
+        }
+        auto gap = std::find_if(gaps.begin(), gaps.end(), [&](const MemorySolver::Gap& g) {
+            return g.id == static_cast<int64_t>(i);
+        });
+        csv << i << ",\"" << edges << "\"," << boxes[i].start << "," << boxes[i].finish << ","
+            << boxes[i].size * alignment << "," << solver.getOffset(i) * alignment << ",";
+        if (gap != gaps.end())
+            csv << gap->start << "," << gap->finish;
+        else
+            csv << ",";
+        csv << "\n";
+    }
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
+    releasedTensors.clear();
+    spillAfter.clear();
+    restoreBefore.clear();
+
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
     size_t edge_clusters_count = edge_clusters.size();
@@ -635,7 +993,7 @@ void MKLDNNGraph::AllocateWithReuse() {
         for (auto &edge : cluster) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation
                 && edge->getParent()->isConstant()) {
-                edge->externalAllocate(weightsCache);
+                edge->externalAllocate(weightsCache, config.hugePages, numaNodeId);
                 erase = true;
             }
         }
@@ -653,6 +1011,7 @@ void MKLDNNGraph::AllocateWithReuse() {
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
+    std::vector<bool> ioOrConst(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
@@ -660,22 +1019,7 @@ void MKLDNNGraph::AllocateWithReuse() {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
 
-            const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
-
-            int64_t e_size = block_desk.getOffsetPadding() + 1;  // size in bytes (from begin of data to last element)
-            for (int j = 0; j < block_desk.getBlockDims().size(); j++)
-                e_size += (block_desk.getBlockDims()[j] - 1) * block_desk.getStrides()[j];
-
-            // In some cases computational formula above doesn't work properly (e.g. for OhIw8o4i layout).
-            // This WA allows to limit the size of allocated memory from below.
-            // TODO: need to properly investigate the root cause of incorrect computations
-            int64_t min_size = 1;
-            for (int64_t dim : block_desk.getBlockDims()) {
-                min_size *= dim;
-            }
-            e_size = std::max(e_size, min_size);
-
-            e_size *= edge->getDesc().getPrecision() == Precision::BIN ? 1 : edge->getDesc().getPrecision().size();
+            int64_t e_size = getEdgeMemorySize(edge);
 
             box.start = std::min(e_start, box.start);
             box.finish = std::max(e_finish, box.finish);
@@ -691,6 +1035,8 @@ void MKLDNNGraph::AllocateWithReuse() {
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
         }
+        // the data of inputs and outputs may be placed in the user blobs instead of the workspace
+        ioOrConst[i] = isConst | isOutput | isInput;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -705,22 +1051,94 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    std::unique_ptr<MemorySolver> memSolver(new MemorySolver(boxes));
+    int64_t required = memSolver->solve();
+
+    std::vector<TensorRelease> releases;
+    std::vector<MemorySolver::Gap> gaps;
+    const int64_t budget = static_cast<int64_t>(config.memoryBudgetMb) * (1 << 20) / alignment;
+    if (budget > 0 && required > budget) {
+        std::vector<bool> pinned(edge_clusters.size());
+        for (auto &release : findTensorReleases(edge_clusters, boxes, ioOrConst)) {
+            if (required <= budget)
+                break;
+
+            // the inputs of a recomputed node must not be released, and a released tensor can't be recomputed from
+            bool conflicts = pinned[release.cluster];
+            for (auto input : release.recomputeInputs)
+                conflicts |= std::any_of(releases.begin(), releases.end(), [&](const TensorRelease& r) { return r.cluster == input; });
+            if (conflicts)
+                continue;
+
+            gaps.push_back(release.gap);
+            std::unique_ptr<MemorySolver> solver(new MemorySolver(boxes, gaps));
+            int64_t size = solver->solve();
+            if (size >= required) {
+                gaps.pop_back();
+                continue;
+            }
+            memSolver = std::move(solver);
+            required = size;
+            for (auto input : release.recomputeInputs)
+                pinned[input] = true;
+            releases.push_back(release);
+        }
+    }
+
+    size_t total_size = static_cast<size_t>(required) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    const MKLDNNMemoryDesc workspaceDesc(TensorDesc(Precision::I8, {total_size}, Layout::C));
+    if (config.hugePages)
+        memWorkspace->CreateWithHugePages(workspaceDesc, numaNodeId);
+    else
+        memWorkspace->Create(workspaceDesc);
+    // huge pages are already placed, mbind() can't handle a part of a huge page mapping anyway
+    if (numaNodeId >= 0 && !memWorkspace->IsHugePagesBacked() && !bindToNumaNode(memWorkspace->GetData(), memWorkspace->GetSize(), numaNodeId)) {
+        // Fallback to the first-touch placement: the workspace is not used yet and current stream threads are
+        // pinned to the NUMA node, so pages are faulted in on the node local for the inference
+        firstTouch(memWorkspace->GetData(), memWorkspace->GetSize());
+    }
+
+    memoryStatistics = MemoryStatistics();
+    memoryStatistics.workspaceSize = total_size;
+    memoryStatistics.peakLiveSize = static_cast<size_t>(memSolver->maxDepth()) * alignment;
 
     if (edge_clusters.empty())
         return;
 
+    if (!config.dumpToDot.empty())
+        dumpMemoryTimeline(config.dumpToDot + "_memory.csv", edge_clusters, boxes, *memSolver, gaps, alignment);
+
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
+    for (auto &release : releases) {
+        ReleasedTensor tensor;
+        tensor.data = workspace_ptr + memSolver->getOffset(release.cluster) * alignment;
+        tensor.size = static_cast<size_t>(boxes[release.cluster].size) * alignment;
+        tensor.producer = release.producer;
+        if (!tensor.producer) {
+            tensor.spillFile = std::shared_ptr<std::FILE>(std::tmpfile(), [](std::FILE* file) {
+                if (file) std::fclose(file);
+            });
+            if (!tensor.spillFile)
+                IE_THROW() << "Failed to create a temporary file to spill tensors to fit the memory budget";
+            spillAfter[release.gap.start - 1].push_back(releasedTensors.size());
+            memoryStatistics.spilledTensors++;
+            memoryStatistics.spilledSize += tensor.size;
+        } else {
+            memoryStatistics.recomputedTensors++;
+            memoryStatistics.recomputedSize += tensor.size;
+        }
+        restoreBefore[release.gap.finish + 1].push_back(releasedTensors.size());
+        releasedTensors.push_back(tensor);
+    }
+
     for (int i = 0; i < edge_clusters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int64_t offset = memSolver->getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
                 edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
@@ -756,12 +1174,40 @@ void MKLDNNGraph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+// createPrimitive() of these nodes touches only the node itself, its fused nodes and the already allocated edges,
+// so it is safe to call it for several such nodes at once. Most of the time there is spent on the JIT code generation.
+static bool canCreatePrimitiveConcurrently(const MKLDNNNodePtr& node) {
+    return one_of(node->getType(), Convolution, Deconvolution, BinaryConvolution, FullyConnected, Pooling, Lrn, SoftMax,
+                  Eltwise, Quantize, MVN, Normalize, Interpolate, ReduceAnd, ReduceL1, ReduceL2, ReduceLogSum,
+                  ReduceLogSumExp, ReduceMax, ReduceMean, ReduceMin, ReduceOr, ReduceProd, ReduceSum, ReduceSumSquare);
+}
+
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
+    std::vector<MKLDNNNodePtr> concurrentNodes;
     for (auto& node : graphNodes) {
+        if (canCreatePrimitiveConcurrently(node)) {
+            concurrentNodes.push_back(node);
+            continue;
+        }
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
     }
+
+    // exceptions must not leave the parallel region, the first one in the topological order is rethrown
+    std::vector<std::exception_ptr> errors(concurrentNodes.size());
+    parallel_for(concurrentNodes.size(), [&](size_t i) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, concurrentNodes[i]->profiling.createPrimitive);
+        try {
+            concurrentNodes[i]->createPrimitive();
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -769,8 +1215,6 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
-        MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
-
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
@@ -786,6 +1230,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         // todo: make sure 'name' exists in this map...
         if (_meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
+                MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
                 IE_THROW() << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
@@ -800,9 +1245,9 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
-    for (MKLDNNNodePtr &node : outputNodes) {
-        // remove out_ from node name
-        std::string name = node->getName().substr(4);
+    for (auto &outputMap : outputNodesMap) {
+        const std::string& name = outputMap.first;
+        const MKLDNNNodePtr& node = outputMap.second;
         const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
         if (out.find(name) == out.end()) {
             // TODO: Create blob from MemoryDesc
@@ -835,7 +1280,7 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
-        int MB = intr_blob.GetDims()[0];
+        int MB = intr_blob.GetDescriptor().data.dims[0];
         int MB_to_process = node->batchToProcess();
         // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
         if (config.batchLimit)
@@ -851,16 +1296,22 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
-
     for (int i = 0; i < graphNodes.size(); i++) {
         if (request != nullptr) {
             request->ThrowIfCanceled();
         }
 
+        // the data released to fit the memory budget is brought back before the node which uses it
+        if (!restoreBefore.empty())
+            RestoreTensors(i);
+
+        if (deferredConstants && !deferredConstants->done && deferredConstants->required[i] > 0)
+            PrepareConstants(*deferredConstants, deferredConstants->required[i]);
+
         PERF(graphNodes[i]);
 
-        if (batch > 0)
+        // the constants are computed once for the whole batch, even when they are deferred to this inference
+        if (batch > 0 && !graphNodes[i]->isConstant())
             graphNodes[i]->setDynamicBatchLim(batch);
 
         ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
@@ -870,11 +1321,49 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
             graphNodes[i]->execute(stream);
         }
         ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+
+        if (!spillAfter.empty())
+            SpillTensors(i);
     }
 
+    // the rest of the constants may be the outputs of the graph
+    if (deferredConstants && !deferredConstants->done)
+        PrepareConstants(*deferredConstants, deferredConstants->nodes.size());
+
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::SpillTensors(int execIndex) {
+    auto tensors = spillAfter.find(execIndex);
+    if (tensors == spillAfter.end())
+        return;
+
+    for (auto idx : tensors->second) {
+        auto &tensor = releasedTensors[idx];
+        std::rewind(tensor.spillFile.get());
+        if (std::fwrite(tensor.data, 1, tensor.size, tensor.spillFile.get()) != tensor.size)
+            IE_THROW() << "Failed to spill a tensor to a temporary file, " << tensor.size << " bytes";
+    }
+}
+
+void MKLDNNGraph::RestoreTensors(int execIndex) {
+    auto tensors = restoreBefore.find(execIndex);
+    if (tensors == restoreBefore.end())
+        return;
+
+    for (auto idx : tensors->second) {
+        auto &tensor = releasedTensors[idx];
+        if (tensor.producer) {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, tensor.producer->profiling.execute);
+            tensor.producer->execute(stream);
+        } else {
+            std::rewind(tensor.spillFile.get());
+            if (std::fread(tensor.data, 1, tensor.size, tensor.spillFile.get()) != tensor.size)
+                IE_THROW() << "Failed to read a spilled tensor back from a temporary file, " << tensor.size << " bytes";
+        }
+    }
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1015,9 +1504,8 @@ void MKLDNNGraph::getInputBlobs(InferenceEngine::BlobMap &resp) {
 }
 
 void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
-    for (auto &it : outputNodes) {
-        std::string name = it->getName().substr(4);
-        resp[name] = it->getParentEdgeAt(0)->getBlob();
+    for (auto &it : outputNodesMap) {
+        resp[it.first] = it.second->getParentEdgeAt(0)->getBlob();
     }
 }
 
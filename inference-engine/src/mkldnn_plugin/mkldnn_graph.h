@@ -17,6 +17,11 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <cstdio>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -52,6 +57,17 @@ public:
                      const MKLDNNExtensionManager::Ptr& extMgr,
                      MKLDNNWeightsSharing::Ptr &w_cache);
 
+    /**
+     * @brief Instantiates a graph already compiled by CreateGraph() once more, e.g. for another stream.
+     * The nodes share the primitives, the descriptors and the constant memory with the template graph,
+     * only the intermediate tensors workspace is allocated for the new instance.
+     * @param templateGraph compiled graph to copy, it must not be executed during the call,
+     * its deferred constants are not executed while the graph is copied
+     * @param w_cache weights cache of the NUMA node the graph is created for
+     * @return false if the template graph has nodes which can't be copied, the graph is left not ready then
+     */
+    bool CloneGraph(const MKLDNNGraph &templateGraph, MKLDNNWeightsSharing::Ptr &w_cache);
+
     bool hasMeanImageFor(const std::string& name) {
         return _meanImages.find(name) != _meanImages.end();
     }
@@ -157,20 +173,54 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * @brief Collects NUMA nodes placement of constant data (weights) and of the intermediate tensors workspace
+     * @param weights map from NUMA node id to amount of constant data bytes placed on the node
+     * @param workspace map from NUMA node id to amount of workspace bytes placed on the node
+     */
+    void GetNumaPlacement(std::map<int, size_t>& weights, std::map<int, size_t>& workspace);
+
+    int GetNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    /**
+     * @brief Memory taken by the intermediate tensors workspace, sizes are in bytes
+     */
+    struct MemoryStatistics {
+        size_t workspaceSize = 0;
+        // max size of the tensors which are alive at the same time
+        size_t peakLiveSize = 0;
+        size_t recomputedTensors = 0;
+        size_t recomputedSize = 0;
+        size_t spilledTensors = 0;
+        size_t spilledSize = 0;
+    };
+
+    const MemoryStatistics& GetMemoryStatistics() const {
+        return memoryStatistics;
+    }
+
     void SortTopologically();
 
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
     void ForgetGraphData() {
+        deferredConstants.reset();
         status = NotReady;
         eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
 
         inputNodes.clear();
         outputNodes.clear();
+        outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        releasedTensors.clear();
+        spillAfter.clear();
+        restoreBefore.clear();
+        memoryStatistics = MemoryStatistics();
     }
     Status status { NotReady };
     Config config;
@@ -182,15 +232,60 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MemoryStatistics memoryStatistics;
+
+    // Tensor of the workspace which memory is given to other tensors between two of its uses to fit
+    // Config::memoryBudgetMb. The data is recomputed by the producer node or read back from the spill file.
+    struct ReleasedTensor {
+        void* data;
+        size_t size;
+        MKLDNNNodePtr producer;
+        std::shared_ptr<std::FILE> spillFile;
+    };
+    std::vector<ReleasedTensor> releasedTensors;
+    // exec index -> indices of releasedTensors to spill after execution of the node or to restore before it
+    std::unordered_map<int, std::vector<size_t>> spillAfter;
+    std::unordered_map<int, std::vector<size_t>> restoreBefore;
+
+    // NUMA node of the stream the graph is created for, -1 if there is no need to control placement of the memory
+    int numaNodeId = -1;
+
+    // Stream is created once per graph, so the steady-state Infer() path doesn't allocate it on every call
+    mkldnn::stream stream;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
+    // Output nodes keyed by the network output name (without "out_" prefix)
+    std::map<std::string, MKLDNNNodePtr> outputNodesMap;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Constant nodes which execution is deferred from the graph compilation to fit Config::deferredConstants.
+    // They are executed in order by the background worker or by Infer() right before the first node which needs them.
+    struct DeferredConstants {
+        std::vector<MKLDNNNodePtr> nodes;
+        // exec index -> number of the first nodes which must be executed before the node
+        std::vector<size_t> required;
+        size_t prepared = 0;
+        std::atomic<bool> done{false};
+        std::atomic<bool> cancelled{false};
+        std::exception_ptr error;
+        std::mutex mutex;
+        mkldnn::stream stream;
+        std::thread worker;
+
+        ~DeferredConstants() {
+            cancelled = true;
+            if (worker.joinable())
+                worker.join();
+        }
+    };
+    // declared after the nodes, so the worker is stopped before they are destroyed
+    std::unique_ptr<DeferredConstants> deferredConstants;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -202,8 +297,15 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void SpillTensors(int execIndex);
+    void RestoreTensors(int execIndex);
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void ExecuteConstantNode(const MKLDNNNodePtr& node, mkldnn::stream& strm);
+    void DeferConstantNodes();
+    void PrepareConstants(DeferredConstants& deferred, size_t count);
+    void BindConstantsToNumaNode();
+    std::vector<MKLDNNMemoryPtr> GetConstantMemory();
     void SetOriginalLayerNames();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
@@ -14,6 +14,7 @@
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include <nodes/mkldnn_permute_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
@@ -677,8 +678,10 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        return fcNode != nullptr && !fcNode->isWeightsCompressed();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
@@ -79,9 +79,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
-        iconv->allocate();
+        const auto& inDesc = inputBlob->getTensorDesc();
+
+        // Convert directly into the graph input memory if it is a plain buffer of the target precision,
+        // that saves both the intermediate blob and the copy inside MKLDNNGraph::PushInputData
+        auto input = graph->inputNodes.find(inputName);
+        if (input != graph->inputNodes.end() && !graph->hasMeanImageFor(inputName) &&
+                inDesc.getLayout() == InferenceEngine::TensorDesc::getLayoutByDims(inDesc.getDims())) {
+            const MKLDNNMemory& inputMem = input->second->getChildEdgeAt(0)->getMemory();
+            if (inputMem.GetDesc().isPlainFormat() &&
+                    MKLDNNExtensionUtils::DataTypeToIEPrecision(inputMem.GetDataType()) == inPrec &&
+                    inputMem.GetElementsCount() == inputBlob->size()) {
+                cpu_convert(inputBlob->cbuffer().as<const void *>(), inputMem.GetPtr(), inDesc.getPrecision(), inPrec, inputBlob->size());
+                return;
+            }
+        }
+
+        // Reuse the conversion blob allocated by the previous inference if the input is not changed
+        auto convIt = convertedInputs.find(inputName);
+        if (convIt != convertedInputs.end() && convIt->second->getTensorDesc().getPrecision() == inPrec &&
+                convIt->second->getTensorDesc().getDims() == inDesc.getDims() &&
+                convIt->second->getTensorDesc().getLayout() == inDesc.getLayout()) {
+            iconv = convIt->second;
+        } else {
+            iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inDesc.getDims(), inDesc.getLayout()));
+            iconv->allocate();
+            convertedInputs[inputName] = iconv;
+        }
         if (inputBlob->size() != iconv->size())
             IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
@@ -98,7 +122,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
-    for (auto input : _inputs) {
+    for (auto &input : _inputs) {
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
@@ -431,14 +455,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
+        auto outputNode = graph->outputNodesMap.find(it.first);
+        if (outputNode != graph->outputNodesMap.end()) {
+            const MKLDNNNodePtr& output = outputNode->second;
             if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             bool canBeInPlace = true;
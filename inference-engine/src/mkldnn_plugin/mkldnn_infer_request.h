@@ -58,6 +58,8 @@ private:
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    // Intermediate blobs for inputs with precision unsupported by the graph, kept between inferences
+    InferenceEngine::BlobMap            convertedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "utils/general_utils.h"
+#include "utils/huge_pages.hpp"
 
 #include <mkldnn_types.h>
 #include <dnnl_types.h>
@@ -44,9 +45,7 @@ size_t MKLDNNMemory::GetSize() const {
 
 size_t MKLDNNMemory::GetElementsCount() const {
     auto desc = GetDescriptor();
-    std::vector<int> dims(desc.data.padded_dims,
-                          desc.data.padded_dims + desc.data.ndims);
-    return std::accumulate(std::begin(dims), std::end(dims), (size_t) 1, std::multiplies<size_t>());
+    return std::accumulate(desc.data.padded_dims, desc.data.padded_dims + desc.data.ndims, (size_t) 1, std::multiplies<size_t>());
 }
 
 void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type, memory::format_tag format, const void* data) {
@@ -60,6 +59,7 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
+    hugePagesBuffer.reset();
     if (data == nullptr) {
         prim.reset(new memory(desc, eng));
 
@@ -89,6 +89,17 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+void MKLDNNMemory::CreateWithHugePages(const mkldnn::memory::desc& desc, int numaNodeId) {
+    auto buffer = allocateHugePages(desc.get_size(), numaNodeId);
+    if (!buffer) {
+        Create(desc);
+        return;
+    }
+    // the mapping is already zero-filled, so pads zeroing is not needed
+    Create(desc, buffer.get(), false);
+    hugePagesBuffer = buffer;
+}
+
 void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size) {
     if (size != 0)
         IE_ASSERT(size <= output.GetDescriptor().get_size());
@@ -150,6 +150,17 @@ public:
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr, bool pads_zeroing = true);
 
+    /**
+     * Like a Create(desc) but the buffer is backed with 2 MB huge pages if it is big enough and OS supports them,
+     * otherwise falls back to the regular allocation. Huge pages are placed on the NUMA node right away,
+     * a negative numaNodeId means no preference.
+     */
+    void CreateWithHugePages(const mkldnn::memory::desc& desc, int numaNodeId = -1);
+
+    bool IsHugePagesBacked() const {
+        return hugePagesBuffer != nullptr;
+    }
+
     // Like a plain format
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format_tag format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, size_t size = 0, bool ftz = true) const;
@@ -169,6 +180,8 @@ public:
 private:
     std::shared_ptr<mkldnn::memory> prim;
     mkldnn::engine eng;
+    // keeps the huge pages mapping alive, oneDNN doesn't own externally allocated buffers
+    std::shared_ptr<void> hugePagesBuffer;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
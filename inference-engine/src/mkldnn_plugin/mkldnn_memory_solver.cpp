@@ -8,12 +8,17 @@
 
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <vector>
 #include <map>
+#include <set>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes) : MemorySolver(boxes, {}) {}
+
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, const std::vector<Gap>& gaps) : _boxes(boxes) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -32,6 +37,29 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     std::vector<bool> ts_exist(max_ts+1);
     for (const Box &b : _boxes) ts_exist[b.start] = true;
 
+    // time slot of a timestamp is the last box start at or before it
+    std::vector<int> slot_of(max_ts+1);
+    for (int ts = 0, slot = -1; ts <= max_ts; ts++) {
+        if (ts_exist[ts]) slot++;
+        slot_of[ts] = slot;
+    }
+    std::set<int64_t> gap_ids;
+    for (const Gap &gap : gaps) {
+        auto box = std::find_if(_boxes.begin(), _boxes.end(), [&](const Box& b) { return b.id == gap.id; });
+        if (box == _boxes.end())
+            IE_THROW() << "There are no box for provided gap ID";
+        if (gap.start <= box->start || gap.finish < gap.start || gap.finish >= box->finish)
+            IE_THROW() << "Gap must lie strictly inside of the box live time";
+        if (!gap_ids.insert(gap.id).second)
+            IE_THROW() << "Box can have a single gap only";
+
+        // the data is kept till the end of the slot of the last use and is brought back at the slot of the next one
+        int first_free = slot_of[gap.start - 1] + 1;
+        int last_free = slot_of[gap.finish + 1] - 1;
+        if (first_free <= last_free)
+            _gaps[gap.id] = {first_free, last_free};
+    }
+
     int rm_ts_s = 0, rm_ts_f = 0;
     int ts_s = 0, ts_f = 0;
     for (Box &b : _boxes) {
@@ -57,19 +85,37 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
-int64_t MemorySolver::solve() {
+int64_t MemorySolver::solve(Strategy strategy) {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    if (strategy == Strategy::FirstFit)
+        return solveFirstFit(_offsets);
+    if (strategy == Strategy::BestFit)
+        return solveBestFit(_offsets);
+
+    std::map<int64_t, int64_t> best_fit_offsets;
+    int64_t first_fit = solveFirstFit(_offsets);
+    int64_t best_fit = solveBestFit(best_fit_offsets);
+    if (best_fit < first_fit) {
+        _offsets.swap(best_fit_offsets);
+        return best_fit;
+    }
+    return first_fit;
+}
+
+int64_t MemorySolver::solveFirstFit(std::map<int64_t, int64_t>& offsets) const {
+    std::vector<Box> boxes = _boxes;
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
+    for (Box& box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -77,6 +123,7 @@ int64_t MemorySolver::solve() {
         do {
             popped_up = false;
             for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
+                if (isInGap(id, i_slot)) continue;
                 for (auto *box_in_slot : time_slots[i_slot]) {
                     // intersect with already stored boxes for all covered time slots
                     // and move up the new one if needed
@@ -87,16 +134,99 @@ int64_t MemorySolver::solve() {
 
         // add current box to covered time slot
         for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+            if (!isInGap(id, i_slot)) time_slots[i_slot].push_back(&box);
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;
     }
 
     return _min_required;
 }
 
+int64_t MemorySolver::solveBestFit(std::map<int64_t, int64_t>& offsets) const {
+    // Boxes placed first are the hardest to fit later. No order is the best one for all the networks, so
+    // the biggest, the longest living and the biggest by size * lifetime boxes are tried first in turn.
+    std::vector<size_t> order(_boxes.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    auto lifetime = [](const Box& box) { return static_cast<int64_t>(box.finish - box.start + 1); };
+    const std::vector<std::function<int64_t(const Box&)>> priorities {
+        [](const Box& box) { return box.size; },
+        [&](const Box& box) { return lifetime(box); },
+        [&](const Box& box) { return box.size * lifetime(box); },
+    };
+
+    int64_t min_required = std::numeric_limits<int64_t>::max();
+    std::vector<int64_t> box_offsets, best_offsets;
+    for (const auto& priority : priorities) {
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            const int64_t l_priority = priority(_boxes[l]), r_priority = priority(_boxes[r]);
+            if (l_priority != r_priority) return l_priority > r_priority;
+            if (_boxes[l].size != _boxes[r].size) return _boxes[l].size > _boxes[r].size;
+            return lifetime(_boxes[l]) > lifetime(_boxes[r]);
+        });
+        int64_t required = placeBestFit(order, box_offsets);
+        if (required < min_required) {
+            min_required = required;
+            best_offsets.swap(box_offsets);
+        }
+    }
+
+    for (size_t i = 0; i < _boxes.size(); i++)
+        offsets[_boxes[i].id] = best_offsets[i];
+    return _boxes.empty() ? 0 : min_required;
+}
+
+int64_t MemorySolver::placeBestFit(const std::vector<size_t>& order, std::vector<int64_t>& box_offsets) const {
+    // indices of the placed boxes alive at each time slot, so only the boxes intersecting in time are searched
+    std::vector<std::vector<size_t>> time_slots(_time_duration);
+    std::vector<size_t> visited(_boxes.size(), _boxes.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of the memory taken by the intersecting boxes
+    box_offsets.assign(_boxes.size(), 0);
+    int64_t min_required = 0;
+
+    for (size_t idx : order) {
+        const Box &box = _boxes[idx];
+        busy.clear();
+        for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
+            if (isInGap(box.id, i_slot)) continue;
+            for (size_t other : time_slots[i_slot]) {
+                if (visited[other] == idx) continue;
+                visited[other] = idx;
+                busy.emplace_back(box_offsets[other], box_offsets[other] + _boxes[other].size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // the smallest hole the box fits in, the space above all the boxes is a hole as well while it doesn't
+        // enlarge the required memory
+        int64_t best_offset = -1;
+        int64_t best_waste = std::numeric_limits<int64_t>::max();
+        int64_t free_from = 0;
+        auto try_hole = [&](int64_t begin, int64_t end) {
+            if (end - begin >= box.size && end - begin - box.size < best_waste) {
+                best_waste = end - begin - box.size;
+                best_offset = begin;
+            }
+        };
+        for (const auto &range : busy) {
+            try_hole(free_from, range.first);
+            free_from = std::max(free_from, range.second);
+        }
+        try_hole(free_from, min_required);
+        if (best_offset == -1)
+            best_offset = free_from;
+
+        box_offsets[idx] = best_offset;
+        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+            if (!isInGap(box.id, i_slot)) time_slots[i_slot].push_back(idx);
+
+        min_required = std::max(min_required, best_offset + box.size);
+    }
+
+    return min_required;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
@@ -116,27 +246,41 @@ int64_t MemorySolver::getOffset(int id) const {
 //======== Private =============//
 
 void MemorySolver::calcDepth() {
-    int64_t top_depth = 0;
-    int64_t depth = 0;
-    std::map<int64_t, std::vector<const Box*>> release_at;
+    // size and number of boxes which appear (positive) or disappear (negative) at the time slot
+    std::map<int, std::pair<int64_t, int64_t>> changes_at;
+    auto change = [&](int time, int64_t size, int64_t count) {
+        changes_at[time].first += size;
+        changes_at[time].second += count;
+    };
 
     for (const Box& box : _boxes) {
-        int64_t time = box.start;
-        depth += box.size;
-        top_depth++;
-
-        release_at[box.finish+1].push_back(&box);
+        change(box.start, box.size, 1);
+        change(box.finish + 1, -box.size, -1);
 
-        for (const Box *b : release_at[time]) {
-            depth -= b->size;
-            top_depth--;
+        auto gap = _gaps.find(box.id);
+        if (gap != _gaps.end()) {
+            change(gap->second.first, -box.size, -1);
+            change(gap->second.second + 1, box.size, 1);
         }
-        release_at.erase(time);
-        IE_ASSERT(top_depth > 0);
+    }
+
+    int64_t depth = 0;
+    int64_t top_depth = 0;
+    _depth = 0;
+    _top_depth = 0;
+    for (const auto& changes : changes_at) {
+        depth += changes.second.first;
+        top_depth += changes.second.second;
+        IE_ASSERT(top_depth >= 0);
 
         _top_depth = std::max(_top_depth, top_depth);
         _depth = std::max(_depth, depth);
     }
 }
 
+bool MemorySolver::isInGap(int64_t id, int slot) const {
+    auto gap = _gaps.find(id);
+    return gap != _gaps.end() && slot >= gap->second.first && slot <= gap->second.second;
+}
+
 }  // namespace MKLDNNPlugin
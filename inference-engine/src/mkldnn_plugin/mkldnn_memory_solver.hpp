@@ -14,6 +14,7 @@
 
 #include <vector>
 #include <map>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -65,18 +66,45 @@ public:
         int64_t id;
     };
 
+    /**
+     * @brief Time interval a box data is not needed in, e.g. between two distant uses of a tensor.
+     * The data is dropped after the timestamp preceding the gap and brought back before the timestamp following it,
+     * so the memory of the box may be given to other boxes during the gap. The box keeps the same offset.
+     */
+    struct Gap {
+        /** Identifier of the box the gap belongs to, a box may have a single gap only */
+        int64_t id;
+
+        /** The first timestamp the data is not needed at, greater than Box.start */
+        int start;
+
+        /** The last timestamp the data is not needed at, less than Box.finish */
+        int finish;
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
+    MemorySolver(const std::vector<Box>& boxes, const std::vector<Gap>& gaps);
+
+    /** Algorithm of the boxes placement */
+    enum class Strategy {
+        /** Boxes are placed from the biggest one, each one is lifted up until it doesn't intersect others */
+        FirstFit,
+        /** Each box goes to the smallest free space it fits in, several orders of the boxes are tried */
+        BestFit,
+        /** Both algorithms are run, the one with the smaller result is taken */
+        Minimal,
+    };
 
     /**
      * @brief Solve memory location with maximal reuse.
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Strategy strategy = Strategy::Minimal);
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
 
-    /** Additional info. Max sum of box sizes required for any time stamp. */
+    /** Additional info. Max sum of box sizes required for any time stamp, the boxes are not accounted in their gaps. */
     int64_t maxDepth();
     /** Additional info. Max num of boxes required for any time stamp. */
     int64_t maxTopDepth();
@@ -84,11 +112,17 @@ public:
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
+    // box id -> the first and the last time slots of the gap after removing of unused timestamps
+    std::map<int64_t, std::pair<int, int>> _gaps;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveFirstFit(std::map<int64_t, int64_t>& offsets) const;
+    int64_t solveBestFit(std::map<int64_t, int64_t>& offsets) const;
+    int64_t placeBestFit(const std::vector<size_t>& order, std::vector<int64_t>& box_offsets) const;
+    bool isInGap(int64_t id, int slot) const;
 };
 
 }  // namespace MKLDNNPlugin
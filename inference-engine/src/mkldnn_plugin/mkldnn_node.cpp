@@ -144,6 +144,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceSumSquare", ReduceSumSquare},
         { "Erf", Eltwise },
         { "Roll", Roll },
+        { "MultiHeadAttention", MultiHeadAttention },
 };
 
 Type TypeFromName(const std::string type) {
@@ -223,6 +224,34 @@ MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::
     }
 }
 
+MKLDNNNode::MKLDNNNode(const MKLDNNNode& other)
+        : InferenceEngine::details::no_copy(), inDims(other.inDims), outDims(other.outDims), fusedWith(other.fusedWith),
+          mergedWith(other.mergedWith), implPriorities(other.implPriorities),
+          inputMemoryFormatsFilter(other.inputMemoryFormatsFilter), outputMemoryFormatsFilter(other.outputMemoryFormatsFilter),
+          originalLayers(other.originalLayers),
+          selectedPrimitiveDescriptorIndex(other.selectedPrimitiveDescriptorIndex), permanent(other.permanent),
+          temporary(other.temporary), dynBatchLim(other.dynBatchLim), constant(other.constant),
+          internalBlobs(other.internalBlobs), internalBlobMemory(other.internalBlobMemory),
+          supportedPrimitiveDescriptors(other.supportedPrimitiveDescriptors), primArgs(other.primArgs), prim(other.prim),
+          descs(other.descs), ext_scales(other.ext_scales), weightCache(other.weightCache), cnnLayer(other.cnnLayer),
+          engine(other.engine), name(other.name), typeStr(other.typeStr), type(other.type), execIndex(other.execIndex),
+          profiling(other.profiling) {}
+
+void MKLDNNNode::rebindMemory(const std::unordered_map<void*, MKLDNNMemoryPtr>& memoryMap) {
+    for (auto &arg : primArgs) {
+        auto found = memoryMap.find(arg.second.get_data_handle());
+        // the rest are constants, they are shared with the original node
+        if (found == memoryMap.end())
+            continue;
+        const auto &memory = found->second->GetPrimitive();
+        // the edge memory object itself is kept where it is possible, so changing of its data handle is visible here
+        if (memory.get_desc() == arg.second.get_desc())
+            arg.second = memory;
+        else
+            arg.second = mkldnn::memory(arg.second.get_desc(), memory.get_engine(), memory.get_data_handle());
+    }
+}
+
 void MKLDNNNode::addEdge(const MKLDNNEdgeWeakPtr& edge) {
     auto edgePtr = edge.lock();
     if (!edgePtr)
@@ -718,6 +747,8 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
         internalBlob = InferenceEngine::make_shared_blob<int32_t>(desc);
     } else if (blb->getTensorDesc().getPrecision() == Precision::BF16) {
         internalBlob = InferenceEngine::make_shared_blob<int16_t>(desc);
+    } else if (blb->getTensorDesc().getPrecision() == Precision::FP16) {
+        internalBlob = InferenceEngine::make_shared_blob<ie_fp16>(desc);
     } else {
         internalBlob = InferenceEngine::make_shared_blob<float>(desc);
     }
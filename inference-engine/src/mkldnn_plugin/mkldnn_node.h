@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <cassert>
 #include <algorithm>
 #include <caseless.hpp>
@@ -88,7 +89,8 @@ enum Type {
     ReduceProd,
     ReduceSum,
     ReduceSumSquare,
-    Roll
+    Roll,
+    MultiHeadAttention
 };
 
 Type TypeFromName(const std::string type);
@@ -209,6 +211,8 @@ static std::string NameFromType(Type type) {
             return "ReduceSumSquare";
         case Roll:
             return "Roll";
+        case MultiHeadAttention:
+            return "MultiHeadAttention";
         default:
             return "Unknown";
     }
@@ -442,6 +446,22 @@ public:
      */
     virtual void init() {}
 
+    /**
+     * @brief Creates a copy of the compiled node for another instance of the same graph (e.g. for another stream).
+     * The copy shares the primitive, the descriptors and the constant memory with this node and gets no edges.
+     * Node types keeping the execution state anywhere but in the edges and the primitive arguments can't be
+     * copied and return nullptr, so the graph containing them is compiled from scratch.
+     */
+    virtual MKLDNNNodePtr clone() const {
+        return nullptr;
+    }
+
+    /**
+     * @brief Binds the primitive arguments of a copy created by clone() to the memory of its own edges.
+     * @param memoryMap maps the data handles of the original graph edges to the memory of the copied edges
+     */
+    virtual void rebindMemory(const std::unordered_map<void*, MKLDNNMemoryPtr>& memoryMap);
+
     template <class PD, class D, typename FPD = bool>
     PD createPrimitiveDescriptor(const mkldnn::primitive_attr &attr = mkldnn::primitive_attr()) {
         auto descsEqual = [](const std::vector<InferenceEngine::TensorDesc>& srcDescs,
@@ -568,6 +588,8 @@ protected:
     std::string originalLayers;  // contains names of the original layers separated by comma
 
     MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
+    // Is used by clone() only, copies the compiled state of the node without the edges and the performance counters
+    MKLDNNNode(const MKLDNNNode& other);
 
     int selectedPrimitiveDescriptorIndex = -1;
     bool permanent = false;
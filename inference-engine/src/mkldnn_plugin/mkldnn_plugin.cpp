@@ -37,6 +37,7 @@
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
 #include <transformations/common_optimizations/softmax_fusion.hpp>
+#include <transformations/common_optimizations/multi_head_attention_fusion.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_shuffle_channels3.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
@@ -284,6 +285,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     pass_config->disable<ngraph::pass::SimplifyCTCGreedyDecoderSeqLen>();
 
     pass_config->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
+    // quantized MatMuls of the attention are left to LPT
+    if (!useLpt)
+        pass_config->enable<ngraph::pass::MultiHeadAttentionFusion>();
 
     if (useLpt) {
         pass_config->set_callback<ngraph::pass::ConvertQuantizeDequantize>([](const_node_ptr &node) -> bool {
@@ -0,0 +1,318 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_streams_auto_tuner.h"
+#include "mkldnn_graph.h"
+
+#include <file_utils.h>
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+#include <legacy/ie_util_internal.hpp>
+#include <legacy/details/ie_cnn_network_tools.h>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <type_traits>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+// 64-bit FNV-1a, the result must not depend on the process as the decisions are stored in files
+class Hash {
+public:
+    void update(const void* data, size_t size) {
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            _value ^= bytes[i];
+            _value *= 1099511628211ull;
+        }
+    }
+
+    void update(const std::string& str) {
+        // the terminating zero separates the neighbouring strings
+        update(str.c_str(), str.size() + 1);
+    }
+
+    template<typename T>
+    void update(const T& value, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr) {
+        update(std::to_string(value));
+    }
+
+    std::string str() const {
+        std::stringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << _value;
+        return ss.str();
+    }
+
+private:
+    uint64_t _value = 14695981039346656037ull;
+};
+
+// Hashing the whole weights of a large model would take noticeable time, so only evenly spaced chunks are hashed
+void updateWithBlobSample(Hash& hash, const Blob::Ptr& blob) {
+    hash.update(blob->byteSize());
+    auto memoryBlob = as<MemoryBlob>(blob);
+    if (!memoryBlob || blob->byteSize() == 0)
+        return;
+    auto locked = memoryBlob->rmap();
+    auto data = locked.as<const uint8_t*>();
+    if (data == nullptr)
+        return;
+    const size_t size = blob->byteSize();
+    const size_t chunkSize = 64;
+    const size_t stride = std::max(chunkSize, size / 64);
+    for (size_t offset = 0; offset < size; offset += stride)
+        hash.update(data + offset, std::min(chunkSize, size - offset));
+}
+
+std::mutex& decisionsMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<std::string, IStreamsExecutor::Config>& decisions() {
+    static std::map<std::string, IStreamsExecutor::Config> cache;
+    return cache;
+}
+
+std::string decisionPath(const std::string& cacheDir, const std::string& hash) {
+    return FileUtils::makePath(cacheDir, hash + ".cpu_auto_tune");
+}
+
+bool readDecision(const std::string& cacheDir, const std::string& hash,
+                  const IStreamsExecutor::Config& defaultConfig, IStreamsExecutor::Config& decision) {
+    std::ifstream file(decisionPath(cacheDir, hash));
+    int streams = 0, threadsPerStream = 0, binding = 0;
+    if (!(file >> streams >> threadsPerStream >> binding))
+        return false;
+    if (streams < 1 || threadsPerStream < 1 ||
+        binding < IStreamsExecutor::ThreadBindingType::NONE || binding > IStreamsExecutor::ThreadBindingType::HYBRID_AWARE)
+        return false;
+    decision = defaultConfig;
+    decision._streams = streams;
+    decision._threadsPerStream = threadsPerStream;
+    decision._threads = streams * threadsPerStream;
+    decision._threadBindingType = static_cast<IStreamsExecutor::ThreadBindingType>(binding);
+    return true;
+}
+
+void writeDecision(const std::string& cacheDir, const std::string& hash, const IStreamsExecutor::Config& decision) {
+    try {
+        FileUtils::createDirectoryRecursive(cacheDir);
+    } catch (...) {
+        // the decision is still kept in the process memory
+        return;
+    }
+    std::ofstream file(decisionPath(cacheDir, hash));
+    file << decision._streams << " " << decision._threadsPerStream << " " << static_cast<int>(decision._threadBindingType) << std::endl;
+}
+
+// Runs the graph in each stream of the candidate configuration for the given time and returns the score:
+// inferences per second for the throughput mode and inferences per second of a single stream for the latency mode
+double measureCandidate(const CNNNetwork& network, const Config& config, const MKLDNNExtensionManager::Ptr& extMgr,
+                        const IStreamsExecutor::Config& candidate, const std::chrono::milliseconds duration) {
+    using Clock = std::chrono::steady_clock;
+    const int streams = candidate._streams;
+    auto executorConfig = candidate;
+    executorConfig._name = "CPUAutoTuneExecutor";
+    auto executor = std::make_shared<CPUStreamsExecutor>(executorConfig);
+    auto weightsCache = std::make_shared<MKLDNNWeightsSharing>();
+    auto graphConfig = config;
+    graphConfig.streamExecutorConfig = candidate;
+    // the candidates are compared in the steady state
+    graphConfig.deferredConstants = Config::DeferredConstants::Off;
+
+    std::deque<MKLDNNGraph> graphs(streams);
+    std::vector<size_t> iterations(streams, 0);
+    std::mutex mutex;
+    std::condition_variable readyCondVar;
+    int readyGraphs = 0;
+    bool failed = false;
+    Clock::time_point start;
+
+    std::vector<Task> tasks(streams);
+    for (int i = 0; i < streams; i++) {
+        tasks[i] = [&, i] {
+            bool created = true;
+            try {
+                graphs[i].setConfig(graphConfig);
+                graphs[i].CreateGraph(cloneNetwork(network), extMgr, weightsCache);
+                // the inputs are never written, zeros keep the indices of Gather, Embedding* and the like
+                // and the trip counts of the loops in range
+                for (auto& input : graphs[i].GetInputNodes()) {
+                    for (size_t j = 0; j < input.second->getChildEdges().size(); j++)
+                        input.second->getChildEdgeAt(j)->getMemoryPtr()->FillZero();
+                }
+                // the first inference is not measured as it includes lazy initializations
+                graphs[i].Infer();
+            } catch (...) {
+                created = false;
+            }
+            // all streams start measuring at the same time, so they compete for the memory bandwidth as in real use
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                failed = failed || !created;
+                if (++readyGraphs == streams) {
+                    start = Clock::now();
+                    readyCondVar.notify_all();
+                } else {
+                    readyCondVar.wait(lock, [&] { return readyGraphs == streams; });
+                }
+            }
+            if (failed)
+                return;
+            const auto end = start + duration;
+            while (Clock::now() < end) {
+                graphs[i].Infer();
+                iterations[i]++;
+            }
+        };
+    }
+    executor->runAndWait(tasks);
+    if (failed)
+        return 0;
+
+    size_t total = 0;
+    for (auto count : iterations)
+        total += count;
+    const double seconds = std::chrono::duration<double>(duration).count();
+    return config.autoTuneMode == Config::AutoTuneMode::Latency ? total / seconds / streams : total / seconds;
+}
+
+}  // namespace
+
+std::vector<IStreamsExecutor::Config> makeAutoTuneCandidates(const IStreamsExecutor::Config& defaultConfig,
+                                                             Config::AutoTuneMode mode,
+                                                             int numaNodes,
+                                                             int maxThreads) {
+    std::vector<IStreamsExecutor::Config> candidates;
+    auto addCandidate = [&](int streams, int threadsPerStream, IStreamsExecutor::ThreadBindingType binding) {
+        if (streams < 1 || threadsPerStream < 1)
+            return;
+        auto same = [&](const IStreamsExecutor::Config& candidate) {
+            return candidate._streams == streams && candidate._threadsPerStream == threadsPerStream &&
+                   candidate._threadBindingType == binding;
+        };
+        if (std::any_of(candidates.begin(), candidates.end(), same))
+            return;
+        auto candidate = defaultConfig;
+        candidate._streams = streams;
+        candidate._threadsPerStream = threadsPerStream;
+        candidate._threads = streams * threadsPerStream;
+        candidate._threadBindingType = binding;
+        candidates.push_back(candidate);
+    };
+
+    const int defaultStreams = std::max(1, defaultConfig._streams);
+    const int defaultThreadsPerStream = std::max(1, defaultConfig._threadsPerStream);
+    const int threads = defaultStreams * defaultThreadsPerStream;
+    const auto binding = defaultConfig._threadBindingType;
+
+    addCandidate(defaultStreams, defaultThreadsPerStream, binding);
+    if (mode == Config::AutoTuneMode::Throughput) {
+        for (auto streams : {numaNodes, threads / 4, threads / 2, threads}) {
+            if (streams >= 1)
+                addCandidate(streams, threads / streams, binding);
+        }
+    } else {
+        for (auto threadsNum : {threads, threads / 2, maxThreads})
+            addCandidate(1, threadsNum, binding);
+    }
+    if (binding != IStreamsExecutor::ThreadBindingType::NONE)
+        addCandidate(defaultStreams, defaultThreadsPerStream, IStreamsExecutor::ThreadBindingType::NONE);
+    return candidates;
+}
+
+std::string computeAutoTuneHash(const CNNNetwork& network, const Config& config) {
+    Hash hash;
+    hash.update(static_cast<int>(config.autoTuneMode));
+    hash.update(config.enforceBF16);
+    hash.update(static_cast<int>(config.weightsCompression));
+    hash.update(config.memoryBudgetMb);
+    hash.update(static_cast<int>(config.lpTransformsMode));
+    hash.update(config.streamExecutorConfig._streams);
+    hash.update(config.streamExecutorConfig._threads);
+    hash.update(static_cast<int>(config.streamExecutorConfig._threadBindingType));
+
+    // the best configuration depends on the machine as much as on the network
+    hash.update(parallel_get_max_threads());
+    hash.update(getNumberOfCPUCores());
+    hash.update(getAvailableNUMANodes().size());
+    hash.update(getAvailableCoresTypes().size());
+    hash.update(with_cpu_x86_avx2());
+    hash.update(with_cpu_x86_avx512_core());
+    hash.update(with_cpu_x86_bfloat16());
+
+    for (auto&& layer : details::CNNNetSortTopologically(network)) {
+        hash.update(layer->type);
+        hash.update(layer->name);
+        hash.update(layer->precision.name());
+        for (auto&& param : layer->params) {
+            hash.update(param.first);
+            hash.update(param.second);
+        }
+        for (auto&& data : layer->outData) {
+            hash.update(data->getPrecision().name());
+            for (auto dim : data->getTensorDesc().getDims())
+                hash.update(dim);
+        }
+        for (auto&& blob : layer->blobs) {
+            hash.update(blob.first);
+            if (blob.second)
+                updateWithBlobSample(hash, blob.second);
+        }
+    }
+    return hash.str();
+}
+
+IStreamsExecutor::Config autoTuneStreams(const CNNNetwork& network,
+                                         const Config& config,
+                                         const MKLDNNExtensionManager::Ptr& extMgr,
+                                         const IStreamsExecutor::Config& defaultConfig) {
+    const auto hash = computeAutoTuneHash(network, config);
+    {
+        std::lock_guard<std::mutex> lock(decisionsMutex());
+        auto found = decisions().find(hash);
+        if (found != decisions().end())
+            return found->second;
+        IStreamsExecutor::Config decision;
+        if (!config.autoTuneCacheDir.empty() && readDecision(config.autoTuneCacheDir, hash, defaultConfig, decision)) {
+            decisions()[hash] = decision;
+            return decision;
+        }
+    }
+
+    auto candidates = makeAutoTuneCandidates(defaultConfig, config.autoTuneMode,
+                                             static_cast<int>(getAvailableNUMANodes().size()), parallel_get_max_threads());
+    const auto duration = std::chrono::milliseconds(std::max<int>(1, config.autoTuneTimeBudgetMs / candidates.size()));
+    auto best = defaultConfig;
+    double bestScore = 0;
+    for (auto&& candidate : candidates) {
+        const auto score = measureCandidate(network, config, extMgr, candidate, duration);
+        if (score > bestScore) {
+            bestScore = score;
+            best = candidate;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(decisionsMutex());
+    decisions()[hash] = best;
+    if (!config.autoTuneCacheDir.empty())
+        writeDecision(config.autoTuneCacheDir, hash, best);
+    return best;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_extension_mngr.h"
+
+#include <cpp/ie_cnn_network.h>
+#include <threading/ie_istreams_executor.hpp>
+
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Makes the candidate streams executor configurations for the auto tuning.
+ * The first candidate is the heuristic default configuration, so it wins the ties.
+ * Throughput mode varies the number of streams sharing the same threads, latency mode uses a single stream
+ * with different number of threads. Both modes also try the default configuration without threads binding.
+ * @param defaultConfig configuration made by IStreamsExecutor::Config::MakeDefaultMultiThreaded
+ * @param mode auto tuning mode, must not be Config::AutoTuneMode::Off
+ * @param numaNodes number of NUMA nodes
+ * @param maxThreads number of logical cores available for the inference
+ * @return unique candidate configurations
+ */
+std::vector<InferenceEngine::IStreamsExecutor::Config> makeAutoTuneCandidates(const InferenceEngine::IStreamsExecutor::Config& defaultConfig,
+                                                                              Config::AutoTuneMode mode,
+                                                                              int numaNodes,
+                                                                              int maxThreads);
+
+/**
+ * @brief Computes the key of the auto tuning decision from the network topology, weights samples,
+ * the auto tuning mode and the machine properties
+ */
+std::string computeAutoTuneHash(const InferenceEngine::CNNNetwork& network, const Config& config);
+
+/**
+ * @brief Selects the streams executor configuration for the network.
+ * The candidates are run on the real graph for config.autoTuneTimeBudgetMs in total,
+ * the decision is cached per computeAutoTuneHash() in the process memory and in config.autoTuneCacheDir if it is set.
+ * @param network network prepared for MKLDNNGraph::CreateGraph
+ * @param config plugin configuration
+ * @param extMgr extensions manager
+ * @param defaultConfig configuration made by IStreamsExecutor::Config::MakeDefaultMultiThreaded
+ * @return the best configuration, defaultConfig if none of the candidates could be run
+ */
+InferenceEngine::IStreamsExecutor::Config autoTuneStreams(const InferenceEngine::CNNNetwork& network,
+                                                          const Config& config,
+                                                          const MKLDNNExtensionManager::Ptr& extMgr,
+                                                          const InferenceEngine::IStreamsExecutor::Config& defaultConfig);
+
+}  // namespace MKLDNNPlugin
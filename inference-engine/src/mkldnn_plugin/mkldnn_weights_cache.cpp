@@ -73,7 +73,7 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
 
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(numa_id);
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -0,0 +1,274 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_kernel.h"
+
+#include <cstring>
+#include <limits>
+#include <mkldnn_types.h>
+#include "cpu_memcpy.h"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_gather, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_f32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_f32)
+
+    explicit jit_uni_gather_kernel_f32(jit_gather_config_params jcp_) : jit_uni_gather_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(count)]);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        if (jcp.vector_gather)
+            vector_gather_loop();
+        rows_loop();
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const uint32_t vlen = cpu_isa_traits<isa>::vlen;
+    // longer rows are copied in a loop instead of the unrolled sequence of moves
+    const size_t max_unrolled_moves = 16;
+
+    // rows of a single 4 byte element, vlen / 4 indices per iteration
+    void vector_gather_loop() {
+        const uint32_t step = vlen / sizeof(int32_t);
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        mov(reg_aux.cvt32(), jcp.index_range);
+        movd(xmm_aux, reg_aux.cvt32());
+        vpbroadcastd(vmm_range, xmm_aux);
+        if (isa == cpu::x64::avx2) {
+            mov(reg_aux.cvt32(), jcp.index_range - 1);
+            movd(xmm_aux, reg_aux.cvt32());
+            vpbroadcastd(vmm_range_max, xmm_aux);
+        }
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            uni_vmovups(vmm_indices, ptr[reg_indices]);
+            if (isa == cpu::x64::avx512_common) {
+                // negative indices are counted from the end
+                vpcmpgtd(k_mask, vmm_zero, vmm_indices);
+                vpaddd(vmm_indices | k_mask, vmm_indices, vmm_range);
+                // only in range indices are loaded, the rest of the lanes stay zero
+                vpcmpud(k_mask, vmm_indices, vmm_range, _cmp_lt_os);
+                uni_vpxor(vmm_dst, vmm_dst, vmm_dst);
+                vpgatherdd(vmm_dst | k_mask, ptr[reg_src + vmm_indices * 4]);
+            } else {
+                vpcmpgtd(vmm_mask, vmm_zero, vmm_indices);
+                vpand(vmm_mask, vmm_mask, vmm_range);
+                vpaddd(vmm_indices, vmm_indices, vmm_mask);
+                // unsigned index < range <=> min(index, range - 1) == index
+                vpminud(vmm_mask, vmm_indices, vmm_range_max);
+                vpcmpeqd(vmm_mask, vmm_mask, vmm_indices);
+                uni_vpxor(vmm_dst, vmm_dst, vmm_dst);
+                vpgatherdd(vmm_dst, ptr[reg_src + vmm_indices * 4], vmm_mask);
+            }
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+
+            add(reg_indices, step * sizeof(int32_t));
+            add(reg_dst, step * sizeof(int32_t));
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(exit_label);
+    }
+
+    void rows_loop() {
+        Xbyak::Label main_loop_label;
+        Xbyak::Label in_range_label;
+        Xbyak::Label next_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(exit_label, T_NEAR);
+
+            movsxd(reg_index, dword[reg_indices]);
+            Xbyak::Label non_negative_label;
+            cmp(reg_index, 0);
+            jge(non_negative_label);
+            add(reg_index, jcp.index_range);
+            L(non_negative_label);
+
+            // the unsigned comparison also rejects the indices which are still negative
+            cmp(reg_index, jcp.index_range);
+            jb(in_range_label, T_NEAR);
+            copy_row(true);
+            jmp(next_label, T_NEAR);
+
+            L(in_range_label);
+            imul(reg_index, reg_index, static_cast<int>(jcp.row_bytes));
+            add(reg_index, reg_src);
+            copy_row(false);
+
+            L(next_label);
+            add(reg_indices, sizeof(int32_t));
+            add(reg_dst, jcp.row_bytes);
+            dec(reg_work_amount);
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(exit_label);
+    }
+
+    // copies the row at reg_index to reg_dst or fills it with zeros
+    void copy_row(bool zeros) {
+        mov(reg_row_dst, reg_dst);
+        if (!zeros)
+            mov(reg_row_src, reg_index);
+
+        size_t moves = jcp.row_bytes / vlen;
+        if (moves > max_unrolled_moves) {
+            Xbyak::Label loop_label;
+            mov(reg_row_work, moves);
+            L(loop_label);
+            {
+                move_vec(vmm_row, 0, zeros);
+                add(reg_row_src, vlen);
+                add(reg_row_dst, vlen);
+                dec(reg_row_work);
+                jnz(loop_label, T_NEAR);
+            }
+            moves = 0;
+        }
+
+        size_t offset = 0;
+        for (size_t i = 0; i < moves; i++, offset += vlen)
+            move_vec(vmm_row, offset, zeros);
+
+        const size_t tail = jcp.row_bytes % vlen;
+        for (size_t size : {32, 16, 8, 4, 2, 1}) {
+            if (size >= vlen)
+                continue;
+            if ((tail & size) == 0)
+                continue;
+            switch (size) {
+                case 32: move_vec(Xbyak::Ymm(vmm_row.getIdx()), offset, zeros); break;
+                case 16: move_vec(Xbyak::Xmm(vmm_row.getIdx()), offset, zeros); break;
+                case 8: move_gpr(reg_aux, offset, zeros); break;
+                case 4: move_gpr(reg_aux.cvt32(), offset, zeros); break;
+                case 2: move_gpr(reg_aux.cvt16(), offset, zeros); break;
+                case 1: move_gpr(reg_aux.cvt8(), offset, zeros); break;
+            }
+            offset += size;
+        }
+    }
+
+    template <typename Reg>
+    void move_vec(const Reg& vreg, size_t offset, bool zeros) {
+        if (zeros) {
+            uni_vmovups(ptr[reg_row_dst + offset], Reg(vmm_zero.getIdx()));
+        } else {
+            uni_vmovups(vreg, ptr[reg_row_src + offset]);
+            uni_vmovups(ptr[reg_row_dst + offset], vreg);
+        }
+    }
+
+    void move_gpr(const Xbyak::Reg& reg, size_t offset, bool zeros) {
+        if (zeros) {
+            xor_(reg, reg);
+        } else {
+            mov(reg, ptr[reg_row_src + offset]);
+        }
+        mov(ptr[reg_row_dst + offset], reg);
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_index = r12;
+    Xbyak::Reg64 reg_row_src = r13;
+    Xbyak::Reg64 reg_row_dst = r14;
+    Xbyak::Reg64 reg_row_work = r15;
+    Xbyak::Reg64 reg_aux = rax;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_dst = Vmm(0);
+    Vmm vmm_indices = Vmm(1);
+    Vmm vmm_mask = Vmm(2);
+    Vmm vmm_range = Vmm(3);
+    Vmm vmm_range_max = Vmm(4);
+    Vmm vmm_zero = Vmm(5);
+    Vmm vmm_row = Vmm(6);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(7);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
+
+GatherKernel::GatherKernel(const GatherParams& params) : params(params), rowBytes(params.data_size * params.row_size) {
+    // the index arithmetic of the kernel is 32 bit for the indices and the row offsets
+    if (params.index_range == 0 || params.index_range > static_cast<size_t>(std::numeric_limits<int32_t>::max()) ||
+        rowBytes == 0 || rowBytes > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return;
+
+    jit_gather_config_params jcp = {};
+    jcp.row_bytes = rowBytes;
+    jcp.index_range = static_cast<int32_t>(params.index_range);
+    jcp.vector_gather = rowBytes == sizeof(int32_t) && mayiuse(cpu::x64::avx2);
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        gather_kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        gather_kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        gather_kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (gather_kernel)
+        gather_kernel->create_ker();
+}
+
+void GatherKernel::execute(const uint8_t* src, const int32_t* indices, uint8_t* dst, size_t count) const {
+    if (gather_kernel) {
+        jit_args_gather args = {src, indices, dst, count};
+        (*gather_kernel)(&args);
+        return;
+    }
+
+    referenceExecute(src, indices, dst, count);
+}
+
+void GatherKernel::referenceExecute(const uint8_t* src, const int32_t* indices, uint8_t* dst, size_t count) const {
+    const auto range = static_cast<int64_t>(params.index_range);
+    for (size_t i = 0; i < count; i++) {
+        int64_t idx = indices[i];
+        if (idx < 0)
+            idx += range;
+        if (idx >= 0 && idx < range) {
+            cpu_memcpy(dst + i * rowBytes, src + idx * rowBytes, rowBytes);
+        } else {
+            memset(dst + i * rowBytes, 0, rowBytes);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+struct GatherParams {
+    // size of an element in bytes
+    size_t data_size;
+    // number of elements in a gathered row
+    size_t row_size;
+    // number of rows the indices address, negative indices are counted from the end
+    size_t index_range;
+};
+
+struct jit_gather_config_params {
+    size_t row_bytes;
+    int32_t index_range;
+    bool vector_gather;
+};
+
+struct jit_args_gather {
+    const void* src;
+    const int32_t* indices;
+    void* dst;
+    size_t count;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_args_gather *);
+
+    void operator()(const jit_args_gather *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_gather_kernel(jit_gather_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_gather_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_gather_config_params jcp;
+};
+
+/**
+ * Copies rows of the source selected by int32 indices to the consecutive rows of the destination.
+ * Indices in [-index_range, 0) are counted from the end, rows of the other out of range indices are filled with zeros.
+ * The JIT kernel is specialized for the row length: rows of a single 4 byte element are loaded with vector gathers
+ * (AVX2 vpgatherdd, AVX-512 vpgatherdd with masks), longer rows are copied with unrolled vector moves.
+ */
+class GatherKernel {
+public:
+    explicit GatherKernel(const GatherParams& params);
+
+    /**
+     * @param src the first row the indices address
+     * @param indices indices of the rows
+     * @param dst destination of count rows
+     * @param count number of indices
+     */
+    void execute(const uint8_t* src, const int32_t* indices, uint8_t* dst, size_t count) const;
+
+private:
+    void referenceExecute(const uint8_t* src, const int32_t* indices, uint8_t* dst, size_t count) const;
+
+    GatherParams params;
+    size_t rowBytes;
+    std::shared_ptr<jit_uni_gather_kernel> gather_kernel;
+};
+
+}  // namespace MKLDNNPlugin
@@ -10,6 +10,7 @@
 #include <mkldnn_extension_utils.h>
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "nodes/permute_tile_imp.hpp"
 
 #include "cpu/x64/jit_generator.hpp"
 
@@ -73,7 +74,7 @@ struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_ge
         Xbyak::Label exit_label;
 
         if (n + 1 == jcp.ndims) {
-            if (jcp.src_strides[n] == jcp.dst_strides[n] == 1) {
+            if (jcp.src_strides[n] == 1 && jcp.dst_strides[n] == 1) {
                 uint32_t step = vlen / jcp.data_size;
 
                 L(main_loop_label);
@@ -254,6 +255,21 @@ void PermuteKernel::prepareParams() {
     jcp.ndims = sorted_order.size();
     jcp.data_size = params.data_size;
 
+    // The innermost destination elements are apart in the source, e.g. the last two dimensions are swapped or the
+    // channel blocks are unfolded. The copy by single elements is replaced with transposes of the matrices formed by
+    // this dimension and the one contiguous in the source, which read and write whole cache lines.
+    const size_t last = jcp.ndims - 1;
+    if (jcp.dst_strides[last] == 1 && jcp.src_strides[last] != 1 && jcp.dst_block_dims[last] > 1) {
+        for (size_t i = 0; i < last; i++) {
+            if (jcp.src_strides[i] == 1 && jcp.dst_block_dims[i] > 1) {
+                tiled = true;
+                tileRowsDim = last;
+                tileColsDim = i;
+                return;
+            }
+        }
+    }
+
     if (mayiuse(cpu::x64::avx512_common)) {
         permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx512_common>(jcp));
     } else if (mayiuse(cpu::x64::avx2)) {
@@ -267,6 +283,11 @@ void PermuteKernel::prepareParams() {
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (tiled) {
+        tiledExecute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -342,6 +363,63 @@ static inline void parallel_step(size_t nDims, const SizeVector& dims, SizeVecto
     }
 }
 
+void PermuteKernel::tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    SizeVector dst_dims = jcp.dst_block_dims;
+    const size_t data_size = jcp.data_size;
+
+    if (dst_dims[0] != mb)
+        dst_dims[0] = mb;
+
+    const size_t rows = dst_dims[tileRowsDim];
+    const size_t cols = dst_dims[tileColsDim];
+    const size_t src_ld = jcp.src_strides[tileRowsDim];
+    const size_t dst_ld = jcp.dst_strides[tileColsDim];
+    // part of the matrix transposed by a single call, the source and the destination lines of it fit L1
+    const size_t block = 64;
+
+    // the outer dimensions and the blocks of the matrix are split between the threads together,
+    // so a few big matrices are transposed in parallel as well as many small ones
+    SizeVector loop_dims, loop_src_strides, loop_dst_strides;
+    for (size_t i = 0; i < dst_dims.size(); i++) {
+        if (i == tileRowsDim || i == tileColsDim)
+            continue;
+        loop_dims.push_back(dst_dims[i]);
+        loop_src_strides.push_back(jcp.src_strides[i]);
+        loop_dst_strides.push_back(jcp.dst_strides[i]);
+    }
+    loop_dims.push_back(div_up(rows, block));
+    loop_src_strides.push_back(block * src_ld);
+    loop_dst_strides.push_back(block);
+    loop_dims.push_back(div_up(cols, block));
+    loop_src_strides.push_back(block);
+    loop_dst_strides.push_back(block * dst_ld);
+
+    const size_t ndims = loop_dims.size();
+    const size_t work_amount = std::accumulate(loop_dims.begin(), loop_dims.end(), size_t(1), std::multiplies<size_t>());
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        SizeVector indexes(ndims, 0);
+        splitter(work_amount, nthr, ithr, start, end);
+
+        parallel_init(start, ndims, loop_dims, indexes);
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            size_t src_idx = 0, dst_idx = 0;
+            for (size_t i = 0; i < ndims; i++) {
+                src_idx += indexes[i] * loop_src_strides[i];
+                dst_idx += indexes[i] * loop_dst_strides[i];
+            }
+            const size_t block_rows = std::min(block, rows - indexes[ndims - 2] * block);
+            const size_t block_cols = std::min(block, cols - indexes[ndims - 1] * block);
+            InferenceEngine::Extensions::Cpu::XARCH::transpose_2d(&src_data[src_idx * data_size], &dst_data[dst_idx * data_size],
+                                                                  block_rows, block_cols, src_ld, dst_ld, data_size);
+
+            parallel_step(ndims, loop_dims, indexes);
+        }
+    });
+}
+
 void PermuteKernel::referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
     SizeVector dst_dims = jcp.dst_block_dims;
     const SizeVector dst_strides = jcp.dst_strides;
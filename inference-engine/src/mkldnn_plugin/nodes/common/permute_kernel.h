@@ -61,11 +61,18 @@ private:
     void prepareParams();
 
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    void tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
     PermuteParams params;
+
+    // the permutation is a batch of 2D transposes of these dimensions of jcp.dst_block_dims,
+    // the first one is the innermost in the destination and the second one is the innermost in the source
+    bool tiled = false;
+    size_t tileRowsDim = 0;
+    size_t tileColsDim = 0;
 };
 
 }  // namespace MKLDNNPlugin
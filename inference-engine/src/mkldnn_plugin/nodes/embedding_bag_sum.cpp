@@ -3,9 +3,11 @@
 //
 
 #include "embedding_bag_sum.hpp"
+#include "embedding_bag_sum_imp.hpp"
 #include "ie_parallel.hpp"
 #include "list.hpp"
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <vector>
@@ -67,7 +69,8 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
             if (data == nullptr)
                 IE_THROW() << logPrefix << "has nullable input data";
             auto prc = data->getTensorDesc().getPrecision();
-            if (prc == Precision::BF16)
+            // bf16 table is read as is and accumulated to fp32 output
+            if (prc == Precision::BF16 && i != 0)
                 prc = Precision::FP32;
             config.inConfs[i].desc = TensorDesc(prc,
                 data->getTensorDesc().getDims(),
@@ -98,40 +101,99 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs,
             ResponseDesc *resp) noexcept {
-    switch (inputs[0]->getTensorDesc().getPrecision()) {
-        case Precision::FP32: {
-            processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::I8: {
-            processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::U8: {
-            processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::I32: {
-            processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
-            break;
-        }
-        default: {
-            if (resp) {
-                std::string errorMsg = "EmbeddingBagSum layer does not support precision '"
-                        + std::string(inputs[0]->getTensorDesc().getPrecision().name()) + "'";
-                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+    try {
+        initFromInputs(inputs);
+
+        switch (inputs[0]->getTensorDesc().getPrecision()) {
+            case Precision::FP32:
+            case Precision::BF16: {
+                processFloatData(inputs, outputs);
+                break;
+            }
+            case Precision::I8: {
+                processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::U8: {
+                processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::I32: {
+                processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
+                break;
+            }
+            default: {
+                IE_THROW() << "EmbeddingBagSum layer does not support precision '"
+                        << std::string(inputs[0]->getTensorDesc().getPrecision().name()) << "'";
             }
-            return GENERAL_ERROR;
         }
+    } catch (const std::exception& e) {
+        if (resp) {
+            std::string errorMsg = e.what();
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+        }
+        return GENERAL_ERROR;
     }
 
     return OK;
 }
 
+template<typename F>
+void MKLDNNEmbeddingBagSum::parallelForBags(size_t bagsNum, size_t tableRows, const F& bagBody) {
+    // an empty bag still fills a row of the output, so it counts as one index
+    _bagsWork.resize(bagsNum + 1);
+    _bagsWork[0] = 0lu;
+    for (size_t obi = 0; obi < bagsNum; obi++) {
+        size_t indicesSize = 0lu;
+        const size_t* indices = nullptr;
+        size_t weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        _bagsWork[obi + 1] = _bagsWork[obi] + std::max<size_t>(indices != nullptr ? indicesSize : 0lu, 1lu);
+    }
+
+    std::vector<std::string> errors(parallel_get_max_threads());
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t workStart(0lu), workEnd(0lu);
+        splitter(_bagsWork[bagsNum], nthr, ithr, workStart, workEnd);
+        // the bag is processed by the thread which gets its first index
+        const size_t start = std::lower_bound(_bagsWork.begin(), _bagsWork.begin() + bagsNum, workStart) - _bagsWork.begin();
+        const size_t end = std::lower_bound(_bagsWork.begin(), _bagsWork.begin() + bagsNum, workEnd) - _bagsWork.begin();
+
+        size_t indicesSize = 0lu;
+        const size_t* indices = nullptr;
+        size_t weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        try {
+            for (size_t obi = start; obi < end; obi++) {
+                getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+                if (indices == nullptr)
+                    indicesSize = 0lu;
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    if (indices[inIdx] >= tableRows)
+                        IE_THROW() << "EmbeddingBagSum layer '" << _layerName
+                            << "' has invalid embedding bag index: " << indices[inIdx];
+                }
+                bagBody(obi, indices, indicesSize, weightsIdx, withWeights & _withWeights);
+            }
+        } catch (const std::exception& e) {
+            errors[ithr] = e.what();
+        }
+    };
+
+    parallel_nt(0, threadBody);
+
+    for (const auto& error : errors) {
+        if (!error.empty())
+            IE_THROW() << error;
+    }
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
-            std::vector<Blob::Ptr>& outputs) noexcept {
+            std::vector<Blob::Ptr>& outputs) {
     const T* srcData = inputs[0]->cbuffer().as<const T*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
     T* dstData = outputs[0]->buffer().as<T*>() +
@@ -139,71 +201,68 @@ void MKLDNNEmbeddingBagSum::processData(
     const T* weightsData = nullptr;
     if (_withWeights)
         weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
-    initFromInputs(inputs);
 
     const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
+    parallelForBags(outputBagsNum, inDataDims[0], [&](size_t obi, const size_t* indices, size_t indicesSize, size_t weightsIdx,
+                                                      bool withWeights) {
+        size_t dstIndex = obi * _embDepth;
+        if (indicesSize == 0lu) {
+            for (size_t i = 0lu; i < _embDepth; i++) {
+                dstData[dstIndex + i] = 0;
+            }
             return;
+        }
 
-        size_t indicesSize = 0lu;
-        const size_t* indices = nullptr;
-        size_t weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        size_t srcIndex = indices[0] * _embDepth;
+        if (withWeights) {
+            for (size_t i = 0lu; i < _embDepth; i++) {
+                dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+            }
+            weightsIdx++;
+        } else {
+            for (size_t i = 0lu; i < _embDepth; i++) {
+                dstData[dstIndex + i] = srcData[srcIndex + i];
+            }
+        }
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    IE_THROW() << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
+        for (size_t inIdx = 1lu; inIdx < indicesSize; inIdx++) {
+            size_t srcIndex = indices[inIdx] * _embDepth;
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        IE_THROW() << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
+            if (withWeights) {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
                 }
+                weightsIdx++;
             } else {
                 for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dstData[dstIndex + i] += srcData[srcIndex + i];
                 }
             }
         }
-    };
+    });
+}
 
-    parallel_nt(0, threadBody);
+void MKLDNNEmbeddingBagSum::processFloatData(
+            std::vector<Blob::Ptr>& inputs,
+            std::vector<Blob::Ptr>& outputs) {
+    const auto& tableDesc = inputs[0]->getTensorDesc();
+    const uint8_t* srcData = inputs[0]->cbuffer().as<const uint8_t*>() +
+        tableDesc.getBlockingDesc().getOffsetPadding() * tableDesc.getPrecision().size();
+    float* dstData = outputs[0]->buffer().as<float*>() +
+        outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const float* weightsData = nullptr;
+    if (_withWeights)
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const float*>();
+
+    const bool bf16Table = tableDesc.getPrecision() == Precision::BF16;
+    const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
+
+    parallelForBags(outputBagsNum, tableDesc.getDims()[0], [&](size_t obi, const size_t* indices, size_t indicesSize, size_t weightsIdx,
+                                                               bool withWeights) {
+        XARCH::emb_bag_sum(srcData, bf16Table, _embDepth, indices, indicesSize,
+                           withWeights ? weightsData + weightsIdx : nullptr, dstData + obi * _embDepth);
+    });
 }
@@ -39,7 +39,14 @@ protected:
         bool& withWeights) = 0;
 
     template<typename T>
-    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
+    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs);
+    // fp32 output accumulated from the fp32 or bf16 table with the vectorized kernel
+    void processFloatData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs);
+
+    // calls bagBody(bagIdx, indices, indicesSize, weightsIdx, withWeights) for each bag of the output, the bags are split
+    // between the threads by the number of indices rather than by the number of bags
+    template<typename F>
+    void parallelForBags(size_t bagsNum, size_t tableRows, const F& bagBody);
 
     std::set<Precision> _supportedPrecisions;
 
@@ -49,6 +56,8 @@ protected:
 
     bool _withWeights = false;
     size_t _embDepth = 0;
+    // prefix sums of the numbers of indices in the bags
+    std::vector<size_t> _bagsWork;
     std::string _layerName;
 
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
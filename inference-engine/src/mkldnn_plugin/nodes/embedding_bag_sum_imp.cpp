@@ -0,0 +1,211 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum_imp.hpp"
+
+#include <cstdint>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// distance in rows between the accumulated row and the prefetched one
+constexpr size_t prefetch_distance = 4;
+constexpr size_t cache_line = 64;
+
+inline float load_scalar(const float* p) {
+    return *p;
+}
+
+inline float load_scalar(const uint16_t* p) {
+    const uint32_t bits = static_cast<uint32_t>(*p) << 16;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = 16;
+typedef __m512 vec_type;
+
+inline vec_type load_vec(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+
+inline vec_type load_vec(const uint16_t* p) {
+    const __m512i bits = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(bits, 16));
+}
+
+inline void store_vec(float* p, vec_type v) {
+    _mm512_storeu_ps(p, v);
+}
+
+inline vec_type set1_vec(float value) {
+    return _mm512_set1_ps(value);
+}
+
+inline vec_type add_vec(vec_type a, vec_type b) {
+    return _mm512_add_ps(a, b);
+}
+
+inline vec_type mul_vec(vec_type a, vec_type b) {
+    return _mm512_mul_ps(a, b);
+}
+
+inline vec_type fmadd_vec(vec_type a, vec_type b, vec_type c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = 8;
+typedef __m256 vec_type;
+
+inline vec_type load_vec(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+
+inline vec_type load_vec(const uint16_t* p) {
+    const __m256i bits = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 16));
+}
+
+inline void store_vec(float* p, vec_type v) {
+    _mm256_storeu_ps(p, v);
+}
+
+inline vec_type set1_vec(float value) {
+    return _mm256_set1_ps(value);
+}
+
+inline vec_type add_vec(vec_type a, vec_type b) {
+    return _mm256_add_ps(a, b);
+}
+
+inline vec_type mul_vec(vec_type a, vec_type b) {
+    return _mm256_mul_ps(a, b);
+}
+
+inline vec_type fmadd_vec(vec_type a, vec_type b, vec_type c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+#elif defined(HAVE_SSE42)
+constexpr size_t vec_len = 4;
+typedef __m128 vec_type;
+
+inline vec_type load_vec(const float* p) {
+    return _mm_loadu_ps(p);
+}
+
+inline vec_type load_vec(const uint16_t* p) {
+    const __m128i bits = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    return _mm_castsi128_ps(_mm_slli_epi32(bits, 16));
+}
+
+inline void store_vec(float* p, vec_type v) {
+    _mm_storeu_ps(p, v);
+}
+
+inline vec_type set1_vec(float value) {
+    return _mm_set1_ps(value);
+}
+
+inline vec_type add_vec(vec_type a, vec_type b) {
+    return _mm_add_ps(a, b);
+}
+
+inline vec_type mul_vec(vec_type a, vec_type b) {
+    return _mm_mul_ps(a, b);
+}
+
+inline vec_type fmadd_vec(vec_type a, vec_type b, vec_type c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+#endif
+
+template <typename T>
+inline void prefetch_row(const T* row, size_t emb_depth) {
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const char* begin = reinterpret_cast<const char*>(row);
+    const char* end = reinterpret_cast<const char*>(row + emb_depth);
+    for (const char* p = begin; p < end; p += cache_line)
+        _mm_prefetch(p, _MM_HINT_T0);
+#endif
+}
+
+// the first row initializes dst, the next ones are accumulated
+template <typename T, bool with_weights, bool first>
+inline void accumulate_row(const T* row, float weight, float* dst, size_t emb_depth) {
+    size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type vweight = set1_vec(weight);
+    for (; i + vec_len <= emb_depth; i += vec_len) {
+        const vec_type vrow = load_vec(row + i);
+        vec_type vdst;
+        if (first)
+            vdst = with_weights ? mul_vec(vrow, vweight) : vrow;
+        else
+            vdst = with_weights ? fmadd_vec(vrow, vweight, load_vec(dst + i)) : add_vec(vrow, load_vec(dst + i));
+        store_vec(dst + i, vdst);
+    }
+#endif
+    for (; i < emb_depth; i++) {
+        const float value = with_weights ? load_scalar(row + i) * weight : load_scalar(row + i);
+        dst[i] = first ? value : dst[i] + value;
+    }
+}
+
+template <typename T, bool with_weights>
+void sum_rows(const T* table, size_t emb_depth, const size_t* indices, size_t indices_num,
+              const float* weights, float* dst) {
+    for (size_t i = 0; i < indices_num && i < prefetch_distance; i++)
+        prefetch_row(table + indices[i] * emb_depth, emb_depth);
+
+    for (size_t i = 0; i < indices_num; i++) {
+        if (i + prefetch_distance < indices_num)
+            prefetch_row(table + indices[i + prefetch_distance] * emb_depth, emb_depth);
+
+        const T* row = table + indices[i] * emb_depth;
+        const float weight = with_weights ? weights[i] : 1.f;
+        if (i == 0)
+            accumulate_row<T, with_weights, true>(row, weight, dst, emb_depth);
+        else
+            accumulate_row<T, with_weights, false>(row, weight, dst, emb_depth);
+    }
+}
+
+template <typename T>
+void emb_bag_sum_impl(const T* table, size_t emb_depth, const size_t* indices, size_t indices_num,
+                      const float* weights, float* dst) {
+    if (weights)
+        sum_rows<T, true>(table, emb_depth, indices, indices_num, weights, dst);
+    else
+        sum_rows<T, false>(table, emb_depth, indices, indices_num, weights, dst);
+}
+
+}  // namespace
+
+void emb_bag_sum(const void* table, bool bf16_table, size_t emb_depth, const size_t* indices, size_t indices_num,
+                 const float* weights, float* dst) {
+    if (indices_num == 0) {
+        std::memset(dst, 0, emb_depth * sizeof(float));
+        return;
+    }
+
+    if (bf16_table)
+        emb_bag_sum_impl(reinterpret_cast<const uint16_t*>(table), emb_depth, indices, indices_num, weights, dst);
+    else
+        emb_bag_sum_impl(reinterpret_cast<const float*>(table), emb_depth, indices, indices_num, weights, dst);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+// Sums the rows of the fp32 (or bf16 if bf16_table is set) table addressed by indices into dst.
+// Rows are multiplied by the corresponding weights when they are given. Rows of the upcoming
+// indices are prefetched while the current row is accumulated.
+void emb_bag_sum(const void* table, bool bf16_table, size_t emb_depth, const size_t* indices, size_t indices_num,
+                 const float* weights, float* dst);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
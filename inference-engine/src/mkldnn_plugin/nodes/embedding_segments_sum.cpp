@@ -75,6 +75,16 @@ public:
             }
         }
 
+        // Segment ids are sorted, so every segment is a contiguous run of the indices
+        _segmentStarts.assign(_numSegments, 0lu);
+        _segmentSizes.assign(_numSegments, 0lu);
+        for (size_t si = _segmentIds.size(); si-- > 0lu;) {
+            if (_segmentIds[si] < _numSegments) {
+                _segmentStarts[_segmentIds[si]] = si;
+                _segmentSizes[_segmentIds[si]]++;
+            }
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -93,17 +103,12 @@ public:
             IE_THROW() << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentSizes[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
+        if (size != 0) {
+            indices = _indices.data() + _segmentStarts[embIndex];
+            weightsIdx = _segmentStarts[embIndex];
         }
 
         // Empty bag
@@ -125,6 +130,8 @@ protected:
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
     std::vector<size_t> _defaultIndices;
+    std::vector<size_t> _segmentStarts;
+    std::vector<size_t> _segmentSizes;
 };
 
 REG_FACTORY_FOR(EmbeddingSegmentsSumImpl, EmbeddingSegmentsSum);
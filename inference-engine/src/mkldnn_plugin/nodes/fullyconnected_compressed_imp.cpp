@@ -0,0 +1,218 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fullyconnected_compressed_imp.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// rows of src which share a single load and conversion of the weights
+constexpr size_t rows_block = 4;
+// outputs whose weights are reused from the cache by all the blocks of rows
+constexpr size_t outputs_block = 8;
+
+// fp16 exponent bias is 15 and fp32 one is 127, the product rebiases normal and denormal values alike
+constexpr float half_to_float_scale = 5.192296858534828e+33f;  // 2^112
+// magnitude of an fp16 infinity shifted to the fp32 mantissa position
+constexpr uint32_t half_inf_magnitude = 0x7c00 << 13;
+
+inline float weight_to_float(uint16_t h) {
+    const uint32_t magnitude = static_cast<uint32_t>(h & 0x7fff) << 13;
+    float value;
+    std::memcpy(&value, &magnitude, sizeof(value));
+    value *= half_to_float_scale;
+
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (magnitude >= half_inf_magnitude)
+        bits |= 0x7f800000;
+    bits |= static_cast<uint32_t>(h & 0x8000) << 16;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline float weight_to_float(int8_t w) {
+    return static_cast<float>(w);
+}
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = 16;
+typedef __m512 vec_type;
+
+inline vec_type zero_vec() {
+    return _mm512_setzero_ps();
+}
+
+inline vec_type load_vec(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+
+inline vec_type load_weights(const uint16_t* p) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+}
+
+inline vec_type load_weights(const int8_t* p) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+}
+
+inline vec_type fmadd_vec(vec_type a, vec_type b, vec_type c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+
+inline float reduce_vec(vec_type v) {
+    return _mm512_reduce_add_ps(v);
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = 8;
+typedef __m256 vec_type;
+
+inline vec_type zero_vec() {
+    return _mm256_setzero_ps();
+}
+
+inline vec_type load_vec(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+
+// the same conversion as weight_to_float, F16C is not a part of the AVX2 build flags
+inline vec_type load_weights(const uint16_t* p) {
+    const __m256i h = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    const __m256i magnitude = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7fff)), 13);
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+    const __m256i inf_nan = _mm256_cmpgt_epi32(magnitude, _mm256_set1_epi32(half_inf_magnitude - 1));
+    const __m256 value = _mm256_mul_ps(_mm256_castsi256_ps(magnitude), _mm256_set1_ps(half_to_float_scale));
+    const __m256i extra_bits = _mm256_or_si256(sign, _mm256_and_si256(inf_nan, _mm256_set1_epi32(0x7f800000)));
+    return _mm256_or_ps(value, _mm256_castsi256_ps(extra_bits));
+}
+
+inline vec_type load_weights(const int8_t* p) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+
+inline vec_type fmadd_vec(vec_type a, vec_type b, vec_type c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+
+inline float reduce_vec(vec_type v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+#elif defined(HAVE_SSE42)
+constexpr size_t vec_len = 4;
+typedef __m128 vec_type;
+
+inline vec_type zero_vec() {
+    return _mm_setzero_ps();
+}
+
+inline vec_type load_vec(const float* p) {
+    return _mm_loadu_ps(p);
+}
+
+inline vec_type load_weights(const uint16_t* p) {
+    const __m128i h = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    const __m128i magnitude = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    const __m128i inf_nan = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(half_inf_magnitude - 1));
+    const __m128 value = _mm_mul_ps(_mm_castsi128_ps(magnitude), _mm_set1_ps(half_to_float_scale));
+    const __m128i extra_bits = _mm_or_si128(sign, _mm_and_si128(inf_nan, _mm_set1_epi32(0x7f800000)));
+    return _mm_or_ps(value, _mm_castsi128_ps(extra_bits));
+}
+
+inline vec_type load_weights(const int8_t* p) {
+    int32_t packed;
+    std::memcpy(&packed, p, sizeof(packed));
+    return _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed)));
+}
+
+inline vec_type fmadd_vec(vec_type a, vec_type b, vec_type c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+
+inline float reduce_vec(vec_type v) {
+    __m128 sum = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+// sums[r] = dot(src row r, weights row) for the consecutive rows of src
+template <typename T, size_t rows>
+inline void dot_rows(const float* src, const T* w, size_t K, float* sums) {
+    size_t k = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    vec_type acc[rows];
+    for (size_t r = 0; r < rows; r++)
+        acc[r] = zero_vec();
+    for (; k + vec_len <= K; k += vec_len) {
+        const vec_type vw = load_weights(w + k);
+        for (size_t r = 0; r < rows; r++)
+            acc[r] = fmadd_vec(load_vec(src + r * K + k), vw, acc[r]);
+    }
+    for (size_t r = 0; r < rows; r++)
+        sums[r] = reduce_vec(acc[r]);
+#else
+    for (size_t r = 0; r < rows; r++)
+        sums[r] = 0.f;
+#endif
+    for (; k < K; k++) {
+        const float wk = weight_to_float(w[k]);
+        for (size_t r = 0; r < rows; r++)
+            sums[r] += src[r * K + k] * wk;
+    }
+}
+
+template <typename T, size_t rows>
+inline void compute_rows(const float* src, const T* weights, const float* scales, const float* bias, float* dst,
+                         size_t N, size_t K, size_t n_begin, size_t n_end) {
+    for (size_t n = n_begin; n < n_end; n++) {
+        float sums[rows];
+        dot_rows<T, rows>(src, weights + n * K, K, sums);
+        const float scale = scales ? scales[n] : 1.f;
+        const float shift = bias ? bias[n] : 0.f;
+        for (size_t r = 0; r < rows; r++)
+            dst[r * N + n] = sums[r] * scale + shift;
+    }
+}
+
+template <typename T>
+void fc_compressed_impl(const float* src, const T* weights, const float* scales, const float* bias, float* dst,
+                        size_t M, size_t N, size_t K, size_t n_begin, size_t n_end) {
+    for (size_t nb = n_begin; nb < n_end; nb += outputs_block) {
+        const size_t nb_end = std::min(nb + outputs_block, n_end);
+        size_t m = 0;
+        for (; m + rows_block <= M; m += rows_block)
+            compute_rows<T, rows_block>(src + m * K, weights, scales, bias, dst + m * N, N, K, nb, nb_end);
+        for (; m < M; m++)
+            compute_rows<T, 1>(src + m * K, weights, scales, bias, dst + m * N, N, K, nb, nb_end);
+    }
+}
+
+}  // namespace
+
+void fc_compressed(const float* src, const void* weights, bool int8_weights, const float* scales, const float* bias,
+                   float* dst, size_t M, size_t N, size_t K, size_t n_begin, size_t n_end) {
+    if (int8_weights)
+        fc_compressed_impl(src, reinterpret_cast<const int8_t*>(weights), scales, bias, dst, M, N, K, n_begin, n_end);
+    else
+        fc_compressed_impl(src, reinterpret_cast<const uint16_t*>(weights), scales, bias, dst, M, N, K, n_begin, n_end);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
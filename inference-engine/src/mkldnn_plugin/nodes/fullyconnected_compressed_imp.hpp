@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+// Computes the outputs [n_begin, n_end) of dst[m][n] = sum_k src[m][k] * w[n][k] * scales[n] + bias[n] for the
+// M x K fp32 src and the N x K weights stored as fp16 (or as int8 if int8_weights is set). The weights are
+// converted to fp32 in registers, so they are never expanded in memory. scales and bias may be nullptr.
+void fc_compressed(const float* src, const void* weights, bool int8_weights, const float* scales, const float* bias,
+                   float* dst, size_t M, size_t N, size_t K, size_t n_begin, size_t n_end);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
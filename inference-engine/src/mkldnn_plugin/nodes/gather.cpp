@@ -11,8 +11,8 @@
 #include <algorithm>
 #include <limits>
 #include "ie_parallel.hpp"
-#include "common/cpu_memcpy.h"
 #include "common/fp16_utils.h"
+#include "common/gather_kernel.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -22,30 +22,51 @@ class GatherImpl: public ExtLayerBase {
 public:
     explicit GatherImpl(const CNNLayer* layer) {
         try {
-            if (layer->insData.size() != 2 || layer->outData.empty())
+            if ((layer->insData.size() != 2 && layer->insData.size() != 3) || layer->outData.empty())
                 IE_THROW() << layer->name << " Incorrect number of input/output edges!";
 
             Precision inIdxPrecision = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getPrecision();
             if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32 && inIdxPrecision != Precision::FP16)
                 inIdxPrecision = Precision::I32;
 
-            axis = layer->GetParamAsInt("axis");
-
             const SizeVector& dictionary_dims = layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getDims();
+            const SizeVector& indexes_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
             if (dictionary_dims.size() == 0)
                 IE_THROW() << layer->name << " Incorrect input parameters dimension!";
+
+            // Gather-7 comes with the axis as a constant input and batch dimensions shared by the dictionary and the indices
+            int batchDims = 0;
+            if (layer->insData.size() == 3) {
+                axis = getConstAxis(layer);
+                batchDims = layer->GetParamAsInt("batch_dims", 0);
+                if (batchDims < 0)
+                    batchDims += indexes_dims.size();
+            } else {
+                axis = layer->GetParamAsInt("axis");
+            }
+
             // Dictionary must be at least rank axis + 1
             IE_ASSERT(-static_cast<int>(dictionary_dims.size()) <= axis && axis < static_cast<int>(dictionary_dims.size()))
                 << layer->name << " Incorrect input parameters dimensions and axis number!";
             if (axis < 0)
                 axis += dictionary_dims.size();
+            if (batchDims < 0 || batchDims > axis || batchDims > static_cast<int>(indexes_dims.size()))
+                IE_THROW() << layer->name << " Incorrect batch_dims " << batchDims << " for axis " << axis << "!";
+            for (int i = 0; i < batchDims; i++) {
+                if (dictionary_dims[i] != indexes_dims[i])
+                    IE_THROW() << layer->name << " Dictionary and indices have different batch dimensions!";
+            }
 
-            //  Find number of dictionaries, index range and data length
-            for (int i = 0; i < axis; i++)
+            //  Find number of batches, number of dictionaries in a batch, index range and data length
+            for (int i = 0; i < batchDims; i++)
+                numBatches *= dictionary_dims[i];
+            for (int i = batchDims; i < axis; i++)
                 numDictionaries *= dictionary_dims[i];
             indexRange = dictionary_dims[axis];
             for (size_t i = axis + 1; i < dictionary_dims.size(); i++)
                 dataLength *= dictionary_dims[i];
+            for (size_t i = batchDims; i < indexes_dims.size(); i++)
+                indexesPerBatch *= indexes_dims[i];
 
             if (dataLength == 0)
                 IE_THROW() << layer->name << " Incorrect input parameters dimension!";
@@ -56,10 +77,15 @@ public:
             dataConfigDct.desc = TensorDesc(dataPrecision, dictionary_dims,
                     layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getLayoutByDims(dictionary_dims));
             config.inConfs.push_back(dataConfigDct);
-            const SizeVector& indexes_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
             dataConfigIdx.desc = TensorDesc(inIdxPrecision, indexes_dims,
                     layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getLayout());
             config.inConfs.push_back(dataConfigIdx);
+            if (layer->insData.size() == 3) {
+                DataConfig dataConfigAxis;
+                const SizeVector& axis_dims = layer->insData[GATHER_AXIS].lock()->getTensorDesc().getDims();
+                dataConfigAxis.desc = TensorDesc(Precision::I32, axis_dims, TensorDesc::getLayoutByDims(axis_dims));
+                config.inConfs.push_back(dataConfigAxis);
+            }
 
             DataConfig dataConfigOut;
             const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
@@ -68,39 +94,41 @@ public:
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
+
+            gatherKernel.reset(new MKLDNNPlugin::GatherKernel({dataPrecision.size(), dataLength, indexRange}));
         } catch (InferenceEngine::Exception &ex) {
             errorMsg = ex.what();
         }
     }
 
-    struct f32toUi32 {
-        inline unsigned int operator()(const float value) {
-            return static_cast<unsigned int>(value);
+    struct f32toI32 {
+        inline int32_t operator()(const float value) {
+            return static_cast<int32_t>(value);
         }
     };
 
-    struct f16toUi32 {
-        inline unsigned int operator()(const ie_fp16 value) {
-            return static_cast<unsigned int>(f16tof32(value));
+    struct f16toI32 {
+        inline int32_t operator()(const ie_fp16 value) {
+            return static_cast<int32_t>(f16tof32(value));
         }
     };
 
-    struct i32toUi32 {
-        inline unsigned int operator()(const int32_t value) {
-            return static_cast<unsigned int>(value);
+    struct i32toI32 {
+        inline int32_t operator()(const int32_t value) {
+            return value;
         }
     };
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
-                gather<float, f32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<float, f32toI32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::FP16:
-                gather<ie_fp16, f16toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<ie_fp16, f16toI32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::I32:
-                gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<int32_t, i32toI32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -110,42 +138,80 @@ public:
     }
 
 private:
+    static int getConstAxis(const CNNLayer* layer) {
+        auto axisLayer = getCreatorLayer(layer->insData[GATHER_AXIS].lock()).lock();
+        if (!axisLayer || axisLayer->type != "Const" || !axisLayer->blobs["custom"] || axisLayer->blobs["custom"]->size() != 1)
+            IE_THROW() << layer->name << " supports only constant scalar axis!";
+        const auto& axisBlob = axisLayer->blobs["custom"];
+        switch (axisBlob->getTensorDesc().getPrecision()) {
+            case Precision::I32:
+                return axisBlob->cbuffer().as<const int32_t*>()[0];
+            case Precision::I64:
+                return static_cast<int>(axisBlob->cbuffer().as<const int64_t*>()[0]);
+            default:
+                IE_THROW() << layer->name << " has unsupported axis precision: " << axisBlob->getTensorDesc().getPrecision();
+        }
+    }
+
+    template <class Conversion, typename index_t>
+    static const int32_t* convertIndexes(const index_t* indexes, size_t count, int32_t* buffer) {
+        for (size_t i = 0; i < count; i++)
+            buffer[i] = Conversion()(indexes[i]);
+        return buffer;
+    }
+
+    template <class Conversion>
+    static const int32_t* convertIndexes(const int32_t* indexes, size_t count, int32_t* buffer) {
+        return indexes;
+    }
+
+    /**
+     * The output is [batches, dictionaries, indexes per batch] rows, the rows of a dictionary are addressed by the indexes
+     * of its batch. The work is split into contiguous ranges of output rows, and every range is passed to the kernel
+     * in the runs of the rows which share the dictionary.
+     */
     template <typename index_t, class Conversion>
     void gather(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
-        size_t src_indexSize = indexes->size();
         const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
         const uint8_t *src_dataDict = dictionary->cbuffer().as<const uint8_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
-
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
-
-            //  Index clipping
-            if (idx < indexRange) {
-                //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    cpu_memcpy_s(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
-            } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
-                }
+        const size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
+        const size_t workAmount = numBatches * numDictionaries * indexesPerBatch;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(workAmount, nthr, ithr, start, end);
+            int32_t buffer[chunkSize];
+
+            while (start < end) {
+                const size_t dictionaryIdx = start / indexesPerBatch;
+                const size_t indexIdx = start % indexesPerBatch;
+                const size_t batchIdx = dictionaryIdx / numDictionaries;
+                const size_t count = std::min({end - start, indexesPerBatch - indexIdx, chunkSize});
+
+                const index_t* indexesPtr = src_index + batchIdx * indexesPerBatch + indexIdx;
+                const int32_t* chunk = convertIndexes<Conversion>(indexesPtr, count, buffer);
+                gatherKernel->execute(&src_dataDict[dictionaryIdx * indexRange * len], chunk, &dst_data[start * len], count);
+                start += count;
             }
         });
     }
 
     int axis = 0;
+    size_t numBatches = 1;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
-    const size_t GATHER_DICTIONARY = 0;
-    const size_t GATHER_INDEXES = 1;
+    size_t indexesPerBatch = 1;
+    std::shared_ptr<MKLDNNPlugin::GatherKernel> gatherKernel;
+    // indexes of other precisions are converted to int32 by the pieces of this size
+    static constexpr size_t chunkSize = 256;
+    static constexpr size_t GATHER_DICTIONARY = 0;
+    static constexpr size_t GATHER_INDEXES = 1;
+    static constexpr size_t GATHER_AXIS = 2;
 };
 
+constexpr size_t GatherImpl::chunkSize;
 
 REG_FACTORY_FOR(GatherImpl, Gather);
 
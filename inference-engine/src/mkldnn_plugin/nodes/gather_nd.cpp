@@ -4,10 +4,12 @@
 
 #include "base.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
-#include "common/cpu_memcpy.h"
+#include "common/gather_kernel.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -66,6 +68,17 @@ public:
             _batchStep *= dataDims[i];
         }
 
+        // the indices of a slice are folded into the number of the block among the sliced dimensions
+        _sliceDims.assign(dataDims.begin() + _batchDims, dataDims.begin() + _batchDims + _sliceRank);
+        _sliceMultipliers.assign(_sliceRank, 1lu);
+        size_t slicesNum = 1lu;
+        for (int i = static_cast<int>(_sliceRank) - 1; i >= 0; i--) {
+            _sliceMultipliers[i] = slicesNum;
+            slicesNum *= _sliceDims[i];
+        }
+        if (slicesNum > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+            IE_THROW() << _errorPrefix << " has too many slices in the data: " << slicesNum;
+
         LayerConfig config;
         DataConfig dataConfig, indicesConfig, outConfig;
         dataConfig.desc = TensorDesc(dataPrecision, dataDims,
@@ -82,133 +95,58 @@ public:
         config.dynBatchSupport = false;
 
         confs.push_back(config);
-    }
 
-    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        if (_blockSize > 1) {
-            gatherBlocks(inputs, outputs, resp);
-        } else {
-            switch (_dataTypeSize) {
-                case sizeof(PrecisionTrait<Precision::I32>::value_type):
-                    gatherElementwise<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
-                    break;
-                case sizeof(PrecisionTrait<Precision::I16>::value_type):
-                    gatherElementwise<PrecisionTrait<Precision::I16>::value_type>(inputs, outputs, resp);
-                    break;
-                case sizeof(PrecisionTrait<Precision::I8>::value_type):
-                    gatherElementwise<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
-                    break;
-                default:
-                    std::string errMsg = _errorPrefix + " has data input with unsupported precision: " +
-                        inputs[_dataIndex]->getTensorDesc().getPrecision().name();
-                    errMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                    return GENERAL_ERROR;
-            }
-        }
-
-        return OK;
+        gatherKernel.reset(new MKLDNNPlugin::GatherKernel({_dataTypeSize, _blockSize, slicesNum}));
     }
 
-protected:
-    template <typename dataType>
-    void gatherElementwise(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept {
-        const dataType* srcData = inputs[_dataIndex]->cbuffer().as<const dataType*>() +
-            inputs[_dataIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        const int* indices = inputs[_indicesIndex]->cbuffer().as<const int*>() +
-            inputs[_indicesIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        dataType* dstData = outputs[0]->buffer().as<dataType*>() +
-            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
-        const size_t* srcMultipliers = inputs[_dataIndex]->getTensorDesc().getBlockingDesc().getStrides().data() + _batchDims;
-
-        const size_t cycles = outputs[0]->byteSize() / (sizeof(dataType) * _batchNum);
-        const size_t CS = cycles * _sliceRank;
-        const size_t CB = cycles * _blockSize;
-        const size_t workAmount = _batchNum * cycles;
-
-        auto threadBody = [&](const int ithr, const int nthr) {
-            size_t start(0lu), end(0lu);
-            splitter(workAmount, nthr, ithr, start, end);
-            if (start >= end)
-                return;
-            size_t bStart = start / cycles;
-            size_t cStart = start % cycles;
-            size_t workCounter = start;
-
-            const dataType* shiftedSrcData = srcData + bStart * _batchStep;
-            const int* shiftedIndices = indices + bStart * CS + cStart * _sliceRank;
-            dataType* shiftedDstData = dstData + bStart * CB + cStart * _blockSize;
-
-            for (size_t b = bStart; b < _batchNum; b++) {
-                for (size_t j = cStart; j < cycles; j++) {
-                    size_t dataIdx = 0lu;
-                    for (size_t i = 0lu; i < _sliceRank; i++)
-                        dataIdx += srcMultipliers[i] * shiftedIndices[i];
-                    shiftedDstData[0] = shiftedSrcData[dataIdx];
-                    shiftedDstData++;
-                    shiftedIndices += _sliceRank;
-                    if (++workCounter == end) {
-                        return;
-                    }
-                }
-                cStart = 0lu;
-                shiftedSrcData += _batchStep;
-            }
-        };
-
-        parallel_nt(0, threadBody);
-    }
-
-    void gatherBlocks(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept {
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const uint8_t* srcData = inputs[_dataIndex]->cbuffer().as<const uint8_t*>() +
-            inputs[_dataIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            inputs[_dataIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding() * _dataTypeSize;
         const int* indices = inputs[_indicesIndex]->cbuffer().as<const int*>() +
             inputs[_indicesIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t* dstData = outputs[0]->buffer().as<uint8_t*>() +
-            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
-        std::vector<size_t> srcMultipliers(_sliceRank);
-        for (size_t i = 0; i < _sliceRank ; i++)
-            srcMultipliers[i] = _dataTypeSize * inputs[_dataIndex]->getTensorDesc().getBlockingDesc().getStrides()[i + _batchDims];
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding() * _dataTypeSize;
 
         const size_t batchStep = _batchStep * _dataTypeSize;
         const size_t dataStep = _blockSize * _dataTypeSize;
         const size_t cycles = outputs[0]->byteSize() / (dataStep * _batchNum);
-        const size_t CS = cycles * _sliceRank;
-        const size_t CB = cycles * dataStep;
         const size_t workAmount = _batchNum * cycles;
 
         auto threadBody = [&](const int ithr, const int nthr) {
             size_t start(0lu), end(0lu);
             splitter(workAmount, nthr, ithr, start, end);
-            if (start >= end)
-                return;
-            size_t bStart = start / cycles;
-            size_t cStart = start % cycles;
-            size_t workCounter = start;
-
-            const uint8_t* shiftedSrcData = srcData + bStart * batchStep;
-            const int* shiftedIndices = indices + bStart * CS + cStart * _sliceRank;
-            uint8_t* shiftedDstData = dstData + bStart * CB + cStart * dataStep;
-
-            for (size_t b = bStart; b < _batchNum; b++) {
-                for (size_t j = cStart; j < cycles; j++) {
-                    size_t dataIdx = 0lu;
-                    for (size_t i = 0; i < _sliceRank ; i++)
-                        dataIdx += srcMultipliers[i] * shiftedIndices[i];
-                    cpu_memcpy(shiftedDstData, &(shiftedSrcData[dataIdx]), dataStep);
-                    shiftedDstData += dataStep;
-                    shiftedIndices += _sliceRank;
-                    if (++workCounter == end) {
-                        return;
-                    }
-                }
-                cStart = 0;
-                shiftedSrcData += batchStep;
+            int32_t blockIndices[chunkSize];
+
+            while (start < end) {
+                const size_t b = start / cycles;
+                const size_t count = std::min({end - start, cycles - start % cycles, chunkSize});
+
+                const int* shiftedIndices = indices + start * _sliceRank;
+                for (size_t j = 0; j < count; j++, shiftedIndices += _sliceRank)
+                    blockIndices[j] = blockIndex(shiftedIndices);
+                gatherKernel->execute(srcData + b * batchStep, blockIndices, dstData + start * dataStep, count);
+                start += count;
             }
         };
 
         parallel_nt(0, threadBody);
+
+        return OK;
+    }
+
+protected:
+    // negative indices are counted from the end of the dimension, the slice is zeros if any index is out of range
+    inline int32_t blockIndex(const int* sliceIndices) const {
+        size_t block = 0lu;
+        for (size_t i = 0; i < _sliceRank; i++) {
+            int64_t idx = sliceIndices[i];
+            if (idx < 0)
+                idx += static_cast<int64_t>(_sliceDims[i]);
+            if (idx < 0 || idx >= static_cast<int64_t>(_sliceDims[i]))
+                return std::numeric_limits<int32_t>::min();
+            block += _sliceMultipliers[i] * idx;
+        }
+        return static_cast<int32_t>(block);
     }
 
     size_t _dataRank;
@@ -218,12 +156,19 @@ protected:
     size_t _batchNum;
     size_t _batchStep;
     size_t _dataTypeSize;
+    std::vector<size_t> _sliceDims;
+    std::vector<size_t> _sliceMultipliers;
+    std::shared_ptr<MKLDNNPlugin::GatherKernel> gatherKernel;
+    // indices of the slices are converted to the block numbers by the pieces of this size
+    static constexpr size_t chunkSize = 256;
     const size_t _dataIndex = 0;
     const size_t _indicesIndex = 1;
     std::string _errorPrefix;
 };
 
 
+constexpr size_t GatherNDImpl::chunkSize;
+
 REG_FACTORY_FOR(GatherNDImpl, GatherND);
 }  // namespace Cpu
 }  // namespace Extensions
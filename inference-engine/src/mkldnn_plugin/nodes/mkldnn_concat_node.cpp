@@ -60,6 +60,16 @@ void MKLDNNConcatNode::getSupportedDescriptors() {
     }
 }
 
+bool MKLDNNConcatNode::isDenseInPlace(const SizeVector& blkDims, size_t axis) {
+    // The inputs share the output strides, so along an inner axis an input is a dense tensor only if all
+    // the outer dimensions but the batch are 1. Producers would fall back to the reference kernels otherwise.
+    for (size_t i = 1; i < axis; i++) {
+        if (blkDims[i] != 1)
+            return false;
+    }
+    return true;
+}
+
 void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -152,7 +162,8 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (axis != 1)
+    // Along an inner axis the inputs can be in-place only in the layouts with channels first, the int8 ones are channels last
+    if (axis == 0 || (axis != 1 && (outputPrecision == Precision::I8 || outputPrecision == Precision::U8)))
         return;
 
     auto numOfDim = static_cast<size_t>(dstDims.ndims());
@@ -246,18 +257,20 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    config.outConfs[0].desc = TensorDesc(
-            MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType),
-            dstDims.ToSizeVector(),
-            {dstDims.ToSizeVector(), order, offset, offsets, strides});
-    for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto parentEdge = getParentEdgeAt(i);
-        config.inConfs[i].inPlace = 0;
-        config.inConfs[i].desc = TensorDesc(MKLDNNExtensionUtils::DataTypeToIEPrecision(inputDataType), parentEdge->getDims().ToSizeVector(),
-                                            {parentEdge->getDims().ToSizeVector(), order, offset, offsets, strides});
-    }
+    if (isDenseInPlace(dstDims.ToSizeVector(), axis)) {
+        config.outConfs[0].desc = TensorDesc(
+                MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType),
+                dstDims.ToSizeVector(),
+                {dstDims.ToSizeVector(), order, offset, offsets, strides});
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            auto parentEdge = getParentEdgeAt(i);
+            config.inConfs[i].inPlace = 0;
+            config.inConfs[i].desc = TensorDesc(MKLDNNExtensionUtils::DataTypeToIEPrecision(inputDataType), parentEdge->getDims().ToSizeVector(),
+                                                {parentEdge->getDims().ToSizeVector(), order, offset, offsets, strides});
+        }
 
-    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, MKLDNNMemory::Convert(config.outConfs[0].desc.getLayout()));
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, MKLDNNMemory::Convert(config.outConfs[0].desc.getLayout()));
+    }
 
     if (numOfDim == 4lu || numOfDim == 5lu) {
         size_t blkDimsLen = numOfDim + 1;
@@ -275,6 +288,8 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 continue;
             blkDims[1] = blkDims[1] / sizeS + (blkDims[1] % sizeS ? 1lu : 0lu);
             blkDims.push_back(sizeS);
+            if (!isDenseInPlace(blkDims, axis))
+                continue;
 
             strides.resize(blkDimsLen);
             strides[blkDimsLen - 1] = 1;
@@ -369,7 +384,7 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
                 canOptimize = false;
         }
     }
-    if (hasUnknown && axis == 1) {
+    if (hasUnknown) {
         if (canSelectPrimitive.size() == 1) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive[0]));
             return;
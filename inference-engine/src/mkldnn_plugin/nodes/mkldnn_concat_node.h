@@ -22,6 +22,11 @@ public:
     void createPrimitive() override;
     void selectOptimalPrimitiveDescriptor() override;
     bool created() const override;
+
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNConcatNode(*this));
+    }
+
     void execute(mkldnn::stream strm) override;
 
     bool isOptimized() const;
@@ -29,9 +34,12 @@ public:
     InferenceEngine::Precision getRuntimePrecision() const override;
 
 private:
+    MKLDNNConcatNode(const MKLDNNConcatNode&) = default;
+
     size_t axis = 0;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    static bool isDenseInPlace(const InferenceEngine::SizeVector& blkDims, size_t axis);
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
@@ -29,6 +29,11 @@ public:
     void filterSupportedDescriptors();
     bool isPossibleToSkipInitConfig(MKLDNNDescriptor &desc);
     bool created() const override;
+
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNConvolutionNode(*this));
+    }
+
     bool canBeInPlace() const override {
         return false;
     }
@@ -61,6 +66,8 @@ protected:
     InferenceEngine::Precision fusedEltwisePrecision(MKLDNNEltwiseNode *eltwiseNode, int findex);
 
 private:
+    MKLDNNConvolutionNode(const MKLDNNConvolutionNode&) = default;
+
     mkldnn::memory::data_type precisionToDataType(InferenceEngine::Precision prec);
     void addZeroPoints(mkldnn::primitive_attr& attr) const;
 
@@ -51,14 +51,30 @@ struct EltwiseEmitterContext {
     std::shared_ptr<jit_emitter> emitter;
     jit_generator *host;
     cpu_isa_t host_isa;
-    const MKLDNNNode *node;
+    const jit_eltwise_op &op;
     InferenceEngine::Precision exec_prc;
 };
 
 template<typename T>
 struct EltwiseEmitter {
     void operator()(EltwiseEmitterContext & ctx) {
-        ctx.emitter = std::make_shared<T>(ctx.host, ctx.host_isa, ctx.node, ctx.exec_prc);
+        // the emitters of the arithmetic and logical operations don't have attributes
+        ctx.emitter = std::make_shared<T>(ctx.host, ctx.host_isa, static_cast<const MKLDNNNode*>(nullptr), ctx.exec_prc);
+    }
+};
+
+template<>
+struct EltwiseEmitter<jit_mkldnn_aux_emitter> {
+    void operator()(EltwiseEmitterContext & ctx) {
+        ctx.emitter = std::make_shared<jit_mkldnn_aux_emitter>(ctx.host, ctx.host_isa, static_cast<mkldnn_alg_kind_t>(ctx.op.algorithm),
+                                                               ctx.op.alpha, ctx.op.beta, ctx.exec_prc);
+    }
+};
+
+template<>
+struct EltwiseEmitter<jit_power_static_emitter> {
+    void operator()(EltwiseEmitterContext & ctx) {
+        ctx.emitter = std::make_shared<jit_power_static_emitter>(ctx.host, ctx.host_isa, ctx.op.alpha, ctx.op.beta, ctx.op.gamma, ctx.exec_prc);
     }
 };
 
@@ -68,7 +84,7 @@ template <cpu_isa_t isa>
 struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_eltwise_generic)
 
-    explicit jit_uni_eltwise_generic(jit_eltwise_params jep, MKLDNNEltwiseNode& eltwiseNode) : jit_uni_eltwise_kernel(jep, eltwiseNode), jit_generator() {}
+    explicit jit_uni_eltwise_generic(jit_eltwise_params jep) : jit_uni_eltwise_kernel(jep), jit_generator() {}
 
     void create_ker() override {
         jit_generator::create_kernel();
@@ -78,10 +94,10 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
     void generate() override {
         Precision exec_prc = Precision::UNSPECIFIED;
 
-        std::set<Precision> supported_precision_intersection = get_supported_precisions(eltwiseNode);
-        for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
-            if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
-                std::set<Precision> prcs = get_supported_precisions(*eltwiseNode.getFusedWith()[i].get());
+        std::set<Precision> supported_precision_intersection = get_supported_precisions(jep_.op);
+        for (int i = 0; i < jep_.post_ops.size(); i++) {
+            if (jep_.post_ops[i].type == Eltwise) {
+                std::set<Precision> prcs = get_supported_precisions(jep_.post_ops[i]);
                 std::set<Precision> prcs_intersect = {};
 
                 std::set_intersection(supported_precision_intersection.begin(), supported_precision_intersection.end(),
@@ -106,21 +122,17 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
         }
 
         if (exec_prc == Precision::UNSPECIFIED) {
-            IE_THROW() << "Eltwise jitter failed to specify execution precision for Eltwise node with name `" << eltwiseNode.getName() << "`";
+            IE_THROW() << "Eltwise jitter failed to specify execution precision for Eltwise node with name `" << jep_.node_name << "`";
         }
 
-        eltwise_emitter = create_eltwise_emitter(eltwiseNode, exec_prc);
-
-        mkldnn::post_ops post_ops;
-        for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
-            if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
-                post_op_emitters.push_back(create_eltwise_emitter(*eltwiseNode.getFusedWith()[i].get(), exec_prc));
-            } else if (eltwiseNode.getFusedWith()[i].get()->getType() == Quantize) {
-                auto quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(eltwiseNode.getFusedWith()[i].get());
-                quantizeNode->appendPostOps(post_ops);
+        eltwise_emitter = create_eltwise_emitter(jep_.op, exec_prc);
 
+        for (int i = 0; i < jep_.post_ops.size(); i++) {
+            if (jep_.post_ops[i].type == Eltwise) {
+                post_op_emitters.push_back(create_eltwise_emitter(jep_.post_ops[i], exec_prc));
+            } else if (jep_.post_ops[i].type == Quantize) {
                 quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
-                        this, post_ops.get()->entry_[post_ops.len() - 1], vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+                        this, jep_.quantization_post_ops.get()->entry_[quantization_injectors.size()], vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
             }
         }
 
@@ -174,7 +186,7 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
                 is_valid_configuration = false;
 
             if (!is_valid_configuration)
-                IE_THROW() << "Eltwise jitter has invalid configuration for Eltwise node with name `" << eltwiseNode.getName() << "`";
+                IE_THROW() << "Eltwise jitter has invalid configuration for Eltwise node with name `" << jep_.node_name << "`";
 
             L(unroll_loop_label);
             {
@@ -359,12 +371,10 @@ private:
         Precision::FP32
     };
 
-    std::set<Precision> get_supported_precisions(MKLDNNNode& node) {
-        auto& eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode&>(node);
-
+    std::set<Precision> get_supported_precisions(const jit_eltwise_op& op) {
         std::set<Precision> precisions;
 
-        OV_SWITCH(MKLDNNPlugin, SupportedPrecisions, precisions, eltwiseNode.getOpType(),
+        OV_SWITCH(MKLDNNPlugin, SupportedPrecisions, precisions, op.eltwise_op,
         OV_CASE(Relu, jit_mkldnn_aux_emitter),
         OV_CASE(Gelu, jit_mkldnn_aux_emitter),
         OV_CASE(Elu, jit_mkldnn_aux_emitter),
@@ -415,18 +425,16 @@ private:
         return precisions;
     }
 
-    std::shared_ptr<jit_emitter> create_eltwise_emitter(MKLDNNNode& node, Precision exec_prec) {
-        const auto& eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode&>(node);
-
+    std::shared_ptr<jit_emitter> create_eltwise_emitter(const jit_eltwise_op& op, Precision exec_prec) {
         EltwiseEmitterContext ctx = {
             nullptr,
             this,
             isa,
-            &node,
+            op,
             exec_prec
         };
 
-        OV_SWITCH(MKLDNNPlugin, EltwiseEmitter, ctx, eltwiseNode.getOpType(),
+        OV_SWITCH(MKLDNNPlugin, EltwiseEmitter, ctx, op.eltwise_op,
         OV_CASE(Relu, jit_mkldnn_aux_emitter),
         OV_CASE(Gelu, jit_mkldnn_aux_emitter),
         OV_CASE(Elu, jit_mkldnn_aux_emitter),
@@ -495,8 +503,8 @@ private:
         int input_idx = eltwise_emitter->get_inputs_num();
         int eltwise_post_op_idx = 0;
         int quantization_post_op_idx = 0;
-        for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
-            if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
+        for (int i = 0; i < jep_.post_ops.size(); i++) {
+            if (jep_.post_ops[i].type == Eltwise) {
                 std::vector<size_t> in_idxs;
                 std::vector<size_t> aux_idxs;
                 in_idxs.push_back(vmm_dst.getIdx());
@@ -512,10 +520,8 @@ private:
 
                 eltwise_post_op_idx++;
             } else {
-                auto quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(eltwiseNode.getFusedWith()[i].get());
-
-                bool do_dequantization = quantizeNode->getOpType() == QuantizeOpType::FakeQuantization;
-                bool do_rounding = do_dequantization || jep_.dst_prc == Precision::FP32 || i != eltwiseNode.getFusedWith().size() - 1;
+                bool do_dequantization = jep_.post_ops[i].do_dequantization;
+                bool do_rounding = do_dequantization || jep_.dst_prc == Precision::FP32 || i != jep_.post_ops.size() - 1;
                 int s_idx = vmm_dst.getIdx();
 
                 quantization_injectors[quantization_post_op_idx]->init_crop_ptrs(reg_oc_off);
@@ -1440,16 +1446,69 @@ void MKLDNNEltwiseNode::createPrimitive() {
 
     jep.oc_size = oc_size;
 
-    if (mayiuse(x64::avx512_common)) {
-        eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(jep, *this));
-    } else if (mayiuse(x64::avx2)) {
-        eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, *this));
-    } else if (mayiuse(x64::sse41)) {
-        eltwise_kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, *this));
+    auto eltwiseOp = [](const MKLDNNEltwiseNode& node) {
+        return jit_eltwise_op{Eltwise, node.getOpType(), node.getAlgorithm(), node.getAlpha(), node.getBeta(), node.getGamma(), false};
+    };
+
+    jep.node_name = getName();
+    jep.op = eltwiseOp(*this);
+    jep.post_ops.clear();
+    jep.quantization_post_ops = mkldnn::post_ops();
+    for (auto& node : fusedWith) {
+        if (node->getType() == Eltwise) {
+            jep.post_ops.push_back(eltwiseOp(*dynamic_cast<MKLDNNEltwiseNode*>(node.get())));
+        } else if (node->getType() == Quantize) {
+            auto quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+            quantizeNode->appendPostOps(jep.quantization_post_ops);
+
+            jit_eltwise_op quantizeOp = {};
+            quantizeOp.type = Quantize;
+            quantizeOp.do_dequantization = quantizeNode->getOpType() == QuantizeOpType::FakeQuantization;
+            jep.post_ops.push_back(quantizeOp);
+        }
     }
 
-    if (eltwise_kernel)
-        eltwise_kernel->create_ker();
+    auto createKernel = [&]() {
+        std::shared_ptr<jit_uni_eltwise_kernel> kernel;
+        if (mayiuse(x64::avx512_common)) {
+            kernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(jep));
+        } else if (mayiuse(x64::avx2)) {
+            kernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep));
+        } else if (mayiuse(x64::sse41)) {
+            kernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep));
+        }
+
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    };
+
+    JitKernelKey key;
+    if (getKernelKey(key)) {
+        eltwise_kernel = JitKernelCache<jit_uni_eltwise_kernel>::getOrCreate(key, createKernel);
+    } else {
+        eltwise_kernel = createKernel();
+    }
+}
+
+bool MKLDNNEltwiseNode::getKernelKey(JitKernelKey& key) const {
+    // fused Quantize puts pointers to its own data into the code
+    for (auto& op : jep.post_ops) {
+        if (op.type != Eltwise)
+            return false;
+    }
+
+    key << jep.inputs_number << jep.input_size << jep.dst_prc.getPrecVal() << jep.dst_offsets << jep.dst_size << jep.oc_size;
+    for (size_t i = 0; i < jep.inputs_number; i++)
+        key << jep.src_prc[i].getPrecVal() << jep.src_offsets[i] << jep.src_size[i];
+
+    auto appendOp = [&key](const jit_eltwise_op& op) {
+        key << op.eltwise_op << op.algorithm << op.alpha << op.beta << op.gamma;
+    };
+    appendOp(jep.op);
+    for (auto& op : jep.post_ops)
+        appendOp(op);
+    return true;
 }
 
 void MKLDNNEltwiseNode::selectOptimalPrimitiveDescriptor() {
@@ -1689,7 +1748,9 @@ void MKLDNNEltwiseNode::executeReference(const std::vector<const uint8_t *>& src
 void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
     size_t inputNum = getParentEdges().size();
 
-    std::vector<const uint8_t *> src_ptrs(inputNum);
+    // The vector is kept between calls to avoid heap allocation on every inference
+    auto& src_ptrs = exec_src_ptrs;
+    src_ptrs.resize(inputNum);
     for (int i = 0; i < inputNum; i++) {
         src_ptrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemory().GetData()) + start_offset_in[i];
     }
@@ -10,6 +10,7 @@
 #include <vector>
 #include <memory>
 #include <caseless.hpp>
+#include "utils/jit_kernel_cache.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -64,6 +65,17 @@ enum EltwiseOpType {
     Erf
 };
 
+// Attributes of the operation computed by the kernel, either the node's own one or a fused post op
+struct jit_eltwise_op {
+    Type type;
+    EltwiseOpType eltwise_op;
+    mkldnn::algorithm algorithm;
+    float alpha;
+    float beta;
+    float gamma;
+    bool do_dequantization;
+};
+
 struct jit_eltwise_params {
     size_t inputs_number;
     size_t input_size;
@@ -77,6 +89,13 @@ struct jit_eltwise_params {
     size_t src_size[MAX_ELTWISE_INPUTS];
     size_t dst_size;
     size_t oc_size;
+
+    // The kernel may outlive the node that created it when it is shared via JitKernelCache,
+    // so everything it needs from the node is copied here
+    std::string node_name;
+    jit_eltwise_op op;
+    std::vector<jit_eltwise_op> post_ops;
+    mkldnn::post_ops quantization_post_ops;
 };
 
 struct jit_eltwise_call_args {
@@ -87,8 +106,6 @@ struct jit_eltwise_call_args {
     size_t oc_off;
 };
 
-class MKLDNNEltwiseNode;
-
 struct jit_uni_eltwise_kernel {
     void (*ker_)(const jit_eltwise_call_args *);
 
@@ -97,13 +114,12 @@ struct jit_uni_eltwise_kernel {
         ker_(args);
     }
 
-    explicit jit_uni_eltwise_kernel(jit_eltwise_params jep, MKLDNNEltwiseNode& node) : ker_(nullptr), jep_(jep), eltwiseNode(node) {}
+    explicit jit_uni_eltwise_kernel(jit_eltwise_params jep) : ker_(nullptr), jep_(jep) {}
     virtual ~jit_uni_eltwise_kernel() {}
 
     virtual void create_ker() = 0;
 
     jit_eltwise_params jep_;
-    MKLDNNEltwiseNode& eltwiseNode;
 };
 
 class MKLDNNEltwiseNode : public MKLDNNNode {
@@ -118,6 +134,11 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNEltwiseNode(*this));
+    }
+
     bool canBeInPlace() const override;
 
     bool isSum();
@@ -131,12 +152,15 @@ public:
 
     float getAlpha() const { return alpha; }
     float getBeta() const { return beta; }
+    float getGamma() const { return gamma; }
 
     void appendPostOps(mkldnn::post_ops& ops) override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
 private:
+    MKLDNNEltwiseNode(const MKLDNNEltwiseNode&) = default;
+
     void init() override;
 
     EltwiseOpType eltwiseOp = Add;
@@ -159,6 +183,7 @@ private:
     std::vector<ptrdiff_t> start_offset_in = {};
     ptrdiff_t start_offset_out = 0;
     std::vector<size_t> offsets_oc = {};
+    std::vector<const uint8_t *> exec_src_ptrs = {};
 
     float alpha = 0;
     float beta = 0;
@@ -174,6 +199,9 @@ private:
     void offset_out_calc(std::vector<size_t>& offset, std::vector<size_t>& dims);
     void offset_in_calc(std::vector<size_t>& offset, std::vector<size_t>& dims_in, std::vector<size_t>& dims_out);
 
+    // Returns false if the kernel can't be shared with other nodes via JitKernelCache
+    bool getKernelKey(JitKernelKey& key) const;
+
     static InferenceEngine::details::caseless_map<std::string,
         std::function<void(InferenceEngine::GenericLayer*, EltwiseOpType&, mkldnn::algorithm&, float&, float&)>> initializers;
 };
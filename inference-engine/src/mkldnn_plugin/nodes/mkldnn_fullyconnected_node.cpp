@@ -12,10 +12,15 @@
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
+#include "ie_parallel.hpp"
+#include "common/cpu_memcpy.h"
+#include "fullyconnected_compressed_imp.hpp"
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
 
 MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache), withBiases(false), baseInputsNumber(0) {
@@ -31,6 +36,16 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLay
     if (getCnnLayer()->type == "FullyConnected" || getCnnLayer()->type == "InnerProduct") {
         baseInputsNumber = getCnnLayer().get()->insData.size();
     }
+
+    // the weights are compressed by the executable network, see KEY_CPU_WEIGHTS_COMPRESSION
+    auto * fcLayer = dynamic_cast<FullyConnectedLayer*>(getCnnLayer().get());
+    if (fcLayer != nullptr && baseInputsNumber == 1 && fcLayer->_weights != nullptr) {
+        const auto weightsPrecision = fcLayer->_weights->getTensorDesc().getPrecision();
+        if (weightsPrecision == Precision::FP16)
+            weightsCompression = WeightsCompression::FP16;
+        else if (weightsPrecision == Precision::I8 && fcLayer->blobs.count("weights_scales"))
+            weightsCompression = WeightsCompression::INT8;
+    }
 }
 
 std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsForDims(const MKLDNNDims &dims) const {
@@ -131,6 +146,15 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
 
+    if (isWeightsCompressed()) {
+        if (!fusedWith.empty() || inputDataType != memory::data_type::f32 || outputDataType != memory::data_type::f32)
+            IE_THROW() << "FullyConnected node " << getName() << " with compressed weights supports only FP32 "
+                       << "input and output without fused operations";
+        if (weightsCompression == WeightsCompression::INT8)
+            internalBlobs.push_back(fcLayer->blobs["weights_scales"]);
+        return;
+    }
+
     for (auto format : getAvailableFormatsForDims(inDims)) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(outDims, outputDataType, memory::format_tag::any);
@@ -139,10 +163,84 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!isWeightsCompressed()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the kernel treats the source as a matrix of rows, so only the plain layouts are supported
+    const auto format = MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims());
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::data_type::f32, format);
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+    config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::data_type::f32,
+                                               MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+    supportedPrimitiveDescriptors.push_back({config, impl_type, format});
+}
+
+void MKLDNNFullyConnectedNode::prepareCompressedWeights() {
+    internalBlobMemory.clear();
+    for (size_t i = 0; i < internalBlobs.size(); i++) {
+        const auto &internalBlob = internalBlobs[i];
+
+        // the weights are addressed by the kernel directly, so the memory only has to keep the bytes
+        auto create = [&] () {
+            MKLDNNMemoryDesc bytesDesc({static_cast<ptrdiff_t>(internalBlob->byteSize())}, memory::data_type::u8,
+                                       memory::format_tag::x);
+            MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+            ptr->Create(bytesDesc);
+            cpu_memcpy(ptr->GetData(), internalBlob->cbuffer(), internalBlob->byteSize());
+            return ptr;
+        };
+
+        MKLDNNMemoryPtr ptr;
+        if (weightCache != nullptr) {
+            const uint64_t data_hash = weightCache->GetHashFunc().hash(
+                    internalBlob->buffer(), internalBlob->byteSize());
+
+            const std::string string_hash = getName() + "_" + std::to_string(i)
+                                            + "_" + std::to_string(internalBlob->byteSize())
+                                            + "_" + std::to_string(data_hash);
+
+            ptr = *weightCache->findOrCreate(string_hash, create);
+        } else {
+            ptr = create();
+        }
+
+        internalBlobMemory.push_back(ptr);
+    }
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
     if (prim)
         return;
 
+    if (isWeightsCompressed()) {
+        if (internalBlobMemory.empty())
+            prepareCompressedWeights();
+        return;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
@@ -158,8 +256,43 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_DST, dst}};
 }
 
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    const auto &srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto &dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src = reinterpret_cast<const float *>(srcMemory.GetPtr());
+    float *dst = reinterpret_cast<float *>(dstMemory.GetPtr());
+
+    // 3D source is a batch of 2D ones sharing the weights, others are flattened to the rows of the batch
+    const auto srcDims = getParentEdgeAt(0)->getDims();
+    const size_t N = weightsDims[0];
+    size_t M, K;
+    if (srcDims.ndims() == 3) {
+        M = static_cast<size_t>(srcDims[0] * srcDims[1]);
+        K = static_cast<size_t>(srcDims[2]);
+    } else {
+        M = static_cast<size_t>(batchToProcess());
+        K = static_cast<size_t>(srcDims.size() / srcDims[0]);
+    }
+
+    const void *weights = internalBlobMemory[0]->GetData();
+    const bool int8Weights = weightsCompression == WeightsCompression::INT8;
+    const float *bias = withBiases ? reinterpret_cast<const float *>(internalBlobMemory[1]->GetData()) : nullptr;
+    const float *scales = int8Weights ? reinterpret_cast<const float *>(internalBlobMemory.back()->GetData()) : nullptr;
+
+    // the weights are the largest tensor, so every thread reads its own share of the outputs' weights
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(N, nthr, ithr, start, end);
+        if (start < end)
+            InferenceEngine::Extensions::Cpu::XARCH::fc_compressed(src, weights, int8Weights, scales, bias, dst,
+                                                                   M, N, K, start, end);
+    });
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (isWeightsCompressed()) {
+        executeCompressed();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -312,6 +445,9 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (isWeightsCompressed())
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
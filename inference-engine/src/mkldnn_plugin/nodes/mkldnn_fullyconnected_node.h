@@ -19,10 +19,15 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNFullyConnectedNode(*this));
+    }
+
     bool canBeInPlace() const override {
         return false;
     }
@@ -43,16 +48,34 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    // The weights are kept in FP16 or INT8 (see KEY_CPU_WEIGHTS_COMPRESSION) and the node runs its own kernel
+    // instead of the oneDNN inner product, so no post ops can be fused into it.
+    bool isWeightsCompressed() const {
+        return weightsCompression != WeightsCompression::None;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
 private:
+    MKLDNNFullyConnectedNode(const MKLDNNFullyConnectedNode&) = default;
+
     InferenceEngine::SizeVector weightsDims;
     InferenceEngine::SizeVector biasesDims;
 
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
+    void prepareCompressedWeights();
+    void executeCompressed();
+
+    enum class WeightsCompression {
+        None,
+        FP16,
+        INT8,
+    };
+    WeightsCompression weightsCompression = WeightsCompression::None;
+
     bool withBiases;
     int baseInputsNumber;
 };
@@ -20,12 +20,18 @@ public:
     void createPrimitive() override;
     bool created() const override;
 
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNInputNode(*this));
+    }
+
     void execute(mkldnn::stream strm) override;
     void withMeanImage() {
         isMeanImage = true;
     }
 
 private:
+    MKLDNNInputNode(const MKLDNNInputNode&) = default;
+
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob;
@@ -23,11 +23,18 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
     bool created() const override;
+
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNLrnNode(*this));
+    }
+
     bool canBeInPlace() const override {
         return false;
     }
 
 private:
+    MKLDNNLrnNode(const MKLDNNLrnNode&) = default;
+
     bool isAcrossMaps = false;
     int size = 1;
     int k = 1;
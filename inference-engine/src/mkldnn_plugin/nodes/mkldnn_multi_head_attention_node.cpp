@@ -0,0 +1,227 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <mkldnn_extension_utils.h>
+
+#include "mkldnn_multi_head_attention_node.h"
+#include "ie_parallel.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+constexpr size_t MKLDNNMultiHeadAttentionNode::queryBlock;
+constexpr size_t MKLDNNMultiHeadAttentionNode::keyBlock;
+
+MKLDNNMultiHeadAttentionNode::MKLDNNMultiHeadAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                                           MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(layer, eng, cache) {
+    layerErrorPrefix = "MultiHeadAttention layer with name '" + layer->name + "'";
+    if ((layer->insData.size() != 3 && layer->insData.size() != 4) || layer->outData.size() != 1)
+        IE_THROW() << layerErrorPrefix << " has incorrect number of input/output edges!";
+    withMask = layer->insData.size() == 4;
+
+    scale = layer->GetParamAsFloat("scale", 1.f);
+    kTransposed = layer->GetParamAsBool("k_transposed", false);
+
+    std::vector<SizeVector> inDims;
+    for (const auto& input : layer->insData) {
+        auto data = input.lock();
+        if (data == nullptr)
+            IE_THROW() << layerErrorPrefix << " has nullable input data";
+        inDims.push_back(data->getTensorDesc().getDims());
+    }
+    for (size_t i = 0; i <= VALUE_INDEX; i++) {
+        if (inDims[i].size() != 4)
+            IE_THROW() << layerErrorPrefix << " supports only 4D query, key and value, got input " << i << " with rank " << inDims[i].size();
+    }
+
+    const auto& queryDims = inDims[QUERY_INDEX];
+    const auto& keyDims = inDims[KEY_INDEX];
+    const auto& valueDims = inDims[VALUE_INDEX];
+    batch = queryDims[0];
+    heads = queryDims[1];
+    queryLength = queryDims[2];
+    headSize = queryDims[3];
+    keyLength = valueDims[2];
+    valueHeadSize = valueDims[3];
+    const SizeVector expectedKeyDims = kTransposed ? SizeVector{batch, heads, headSize, keyLength}
+                                                   : SizeVector{batch, heads, keyLength, headSize};
+    if (keyDims != expectedKeyDims || valueDims[0] != batch || valueDims[1] != heads)
+        IE_THROW() << layerErrorPrefix << " has inconsistent query, key and value dimensions";
+    if (layer->outData[0]->getTensorDesc().getDims() != SizeVector{batch, heads, queryLength, valueHeadSize})
+        IE_THROW() << layerErrorPrefix << " has incorrect output dimensions";
+
+    if (withMask) {
+        auto maskDims = inDims[MASK_INDEX];
+        if (maskDims.size() > 4)
+            IE_THROW() << layerErrorPrefix << " doesn't support mask with rank " << maskDims.size();
+        maskDims.insert(maskDims.begin(), 4 - maskDims.size(), 1);
+        const SizeVector scoresDims{batch, heads, queryLength, keyLength};
+        maskStrides.assign(4, 0);
+        size_t stride = 1;
+        for (int i = 3; i >= 0; i--) {
+            if (maskDims[i] != 1 && maskDims[i] != scoresDims[i])
+                IE_THROW() << layerErrorPrefix << " has mask which is not broadcastable to the attention scores";
+            maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+            stride *= maskDims[i];
+        }
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::getSupportedDescriptors() {}
+
+void MKLDNNMultiHeadAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+
+    auto createDataConfig = [](const MKLDNNDims& dims) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(i)->getDims()));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims()));
+
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
+}
+
+void MKLDNNMultiHeadAttentionNode::createPrimitive() {
+    // scores of a block, the key tile repacked to [headSize, keyBlock], running maximums and sums of the rows
+    scratchSize = queryBlock * keyBlock + (kTransposed ? 0 : headSize * keyBlock) + 2 * queryBlock;
+    scratchBuffer.resize(scratchSize * parallel_get_max_threads());
+}
+
+void MKLDNNMultiHeadAttentionNode::execute(mkldnn::stream strm) {
+    const auto* query = reinterpret_cast<const float*>(getParentEdgeAt(QUERY_INDEX)->getMemoryPtr()->GetPtr());
+    const auto* key = reinterpret_cast<const float*>(getParentEdgeAt(KEY_INDEX)->getMemoryPtr()->GetPtr());
+    const auto* value = reinterpret_cast<const float*>(getParentEdgeAt(VALUE_INDEX)->getMemoryPtr()->GetPtr());
+    const auto* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_INDEX)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t queryBlocks = (queryLength + queryBlock - 1) / queryBlock;
+    const size_t workAmount = batch * heads * queryBlocks;
+    const int threads = static_cast<int>(std::min<size_t>(parallel_get_max_threads(), scratchBuffer.size() / scratchSize));
+    parallel_nt(threads, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        float* scratch = scratchBuffer.data() + ithr * scratchSize;
+        for (size_t work = start; work < end; work++) {
+            const size_t qBlock = work % queryBlocks;
+            const size_t h = (work / queryBlocks) % heads;
+            const size_t b = work / queryBlocks / heads;
+            const size_t qStart = qBlock * queryBlock;
+            executeBlock(query, key, value, mask, dst, b, h, qStart, std::min(qStart + queryBlock, queryLength), scratch);
+        }
+    });
+}
+
+void MKLDNNMultiHeadAttentionNode::executeBlock(const float* query, const float* key, const float* value, const float* mask, float* dst,
+                                                size_t b, size_t h, size_t qStart, size_t qEnd, float* scratch) const {
+    const size_t rows = qEnd - qStart;
+    float* scores = scratch;
+    float* rowMax = scores + queryBlock * keyBlock;
+    float* rowSum = rowMax + queryBlock;
+    float* keyT = rowSum + queryBlock;
+
+    const size_t head = b * heads + h;
+    const float* q = query + (head * queryLength + qStart) * headSize;
+    const float* k = key + head * keyLength * headSize;
+    const float* v = value + head * keyLength * valueHeadSize;
+    // the output rows accumulate the products of the unnormalized probabilities and the values
+    float* out = dst + (head * queryLength + qStart) * valueHeadSize;
+
+    const float negInf = -std::numeric_limits<float>::infinity();
+    std::fill(out, out + rows * valueHeadSize, 0.f);
+    std::fill(rowMax, rowMax + rows, negInf);
+    std::fill(rowSum, rowSum + rows, 0.f);
+
+    for (size_t kStart = 0; kStart < keyLength; kStart += keyBlock) {
+        const size_t cols = std::min(keyBlock, keyLength - kStart);
+
+        // K^T tile, so the inner loops of the scores go along contiguous memory
+        const float* kt = k + kStart;
+        size_t ldkt = keyLength;
+        if (!kTransposed) {
+            for (size_t j = 0; j < cols; j++) {
+                const float* kj = k + (kStart + j) * headSize;
+                for (size_t d = 0; d < headSize; d++)
+                    keyT[d * cols + j] = kj[d];
+            }
+            kt = keyT;
+            ldkt = cols;
+        }
+
+        for (size_t i = 0; i < rows; i++) {
+            float* s = scores + i * keyBlock;
+            std::fill(s, s + cols, 0.f);
+            const float* qi = q + i * headSize;
+            for (size_t d = 0; d < headSize; d++) {
+                const float qd = qi[d] * scale;
+                const float* ktd = kt + d * ldkt;
+                for (size_t j = 0; j < cols; j++)
+                    s[j] += qd * ktd[j];
+            }
+            if (withMask) {
+                const float* m = mask + b * maskStrides[0] + h * maskStrides[1] + (qStart + i) * maskStrides[2] + kStart * maskStrides[3];
+                const size_t mStride = maskStrides[3];
+                for (size_t j = 0; j < cols; j++)
+                    s[j] += m[j * mStride];
+            }
+
+            float tileMax = negInf;
+            for (size_t j = 0; j < cols; j++)
+                tileMax = std::max(tileMax, s[j]);
+            const float newMax = std::max(rowMax[i], tileMax);
+            // the row is fully masked so far
+            if (newMax == negInf)
+                continue;
+
+            float tileSum = 0.f;
+            for (size_t j = 0; j < cols; j++) {
+                s[j] = std::exp(s[j] - newMax);
+                tileSum += s[j];
+            }
+            const float correction = std::exp(rowMax[i] - newMax);
+            rowSum[i] = rowSum[i] * correction + tileSum;
+            rowMax[i] = newMax;
+
+            float* o = out + i * valueHeadSize;
+            if (correction != 1.f) {
+                for (size_t d = 0; d < valueHeadSize; d++)
+                    o[d] *= correction;
+            }
+            for (size_t j = 0; j < cols; j++) {
+                const float p = s[j];
+                const float* vj = v + (kStart + j) * valueHeadSize;
+                for (size_t d = 0; d < valueHeadSize; d++)
+                    o[d] += p * vj[d];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < rows; i++) {
+        const float norm = rowSum[i] > 0.f ? 1.f / rowSum[i] : 0.f;
+        float* o = out + i * valueHeadSize;
+        for (size_t d = 0; d < valueHeadSize; d++)
+            o[d] *= norm;
+    }
+}
+
+bool MKLDNNMultiHeadAttentionNode::created() const {
+    return getType() == MultiHeadAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNMultiHeadAttentionNode, MultiHeadAttention)
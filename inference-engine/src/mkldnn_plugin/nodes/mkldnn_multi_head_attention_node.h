@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes Softmax(scale * Q x K^T + mask) x V for all the heads without materializing the attention scores.
+ * Each thread takes blocks of query rows of a head and iterates over the keys in tiles, the tile scores are
+ * folded into the output with the running row maximum and sum of exponents (online softmax), so the working set
+ * of a block is a few tiles that fit into L2 cache regardless of the sequence length.
+ */
+class MKLDNNMultiHeadAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNMultiHeadAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNMultiHeadAttentionNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    void executeBlock(const float* query, const float* key, const float* value, const float* mask, float* dst,
+                      size_t b, size_t h, size_t qStart, size_t qEnd, float* scratch) const;
+
+    std::string layerErrorPrefix;
+    float scale = 1.f;
+    bool kTransposed = false;
+    bool withMask = false;
+
+    size_t batch = 0, heads = 0, queryLength = 0, keyLength = 0, headSize = 0, valueHeadSize = 0;
+    // strides of the mask broadcasted to [batch, heads, queryLength, keyLength], zero for the broadcasted dimensions
+    std::vector<size_t> maskStrides;
+    size_t scratchSize = 0;
+    std::vector<float> scratchBuffer;
+
+    // rows of queries and columns of keys processed at once
+    static constexpr size_t queryBlock = 32;
+    static constexpr size_t keyBlock = 64;
+
+    const size_t QUERY_INDEX = 0ul;
+    const size_t KEY_INDEX = 1ul;
+    const size_t VALUE_INDEX = 2ul;
+    const size_t MASK_INDEX = 3ul;
+};
+
+}  // namespace MKLDNNPlugin
@@ -8,8 +8,6 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
-#include <utility>
-#include <map>
 #include <memory>
 #include "common/permute_kernel.h"
 
@@ -37,16 +35,6 @@ private:
     InferenceEngine::SizeVector order;
     InferenceEngine::Precision prec;
 
-    typedef std::function<void(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> permuteImpl;
-    typedef std::function<bool(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> isApplicable;
-    struct PermuteImpl {
-        PermuteImpl(permuteImpl f0, isApplicable f1): execute(std::move(f0)), isValidParams(std::move(f1)) {}
-
-        permuteImpl execute;
-        isApplicable isValidParams;
-    };
-
-    static const std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
     std::unique_ptr<PermuteKernel> permuteKernel;
 };
 
@@ -25,11 +25,18 @@ public:
     void initDescriptor(const InferenceEngine::LayerConfig &config) override;
     void createPrimitive() override;
     bool created() const override;
+
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNPoolingNode(*this));
+    }
+
     bool canBeInPlace() const override {
         return false;
     }
 
 private:
+    MKLDNNPoolingNode(const MKLDNNPoolingNode&) = default;
+
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
 
     InferenceEngine::PoolingLayer::PoolType type = InferenceEngine::PoolingLayer::MAX;
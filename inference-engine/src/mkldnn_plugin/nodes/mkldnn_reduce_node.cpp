@@ -13,6 +13,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "utils/bfloat16.hpp"
+#include "utils/jit_kernel_cache.hpp"
 #include "emitters/jit_bf16_emitters.hpp"
 #include "ie_parallel.hpp"
 #include <algorithm>
@@ -1479,26 +1480,44 @@ void MKLDNNReduceNode::createPrimitive() {
     jcp.planar_layout = planar_layout;
     jcp.reduce_mode = reduceMode;
 
+    // the kernels depend on the config only, so identical Reduce nodes share them
+    JitKernelKey key;
+    key << jcp.planar_layout << jcp.reduce_mode << jcp.src_dt << jcp.dst_dt << jcp.src_data_size << jcp.dst_data_size;
+
+    reduce_kernel = JitKernelCache<jit_uni_reduce_kernel>::getOrCreate(key, [&jcp]() {
+        std::shared_ptr<jit_uni_reduce_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    });
+
+    reduce_post_kernel = JitKernelCache<jit_uni_reduce_post_kernel>::getOrCreate(key, [&jcp]() {
+        std::shared_ptr<jit_uni_reduce_post_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>(jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+        if (kernel)
+            kernel->create_ker();
+        return kernel;
+    });
+
     if (mayiuse(cpu::x64::avx512_common)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_common>(jcp));
         blk_size = 16;
-    } else if (mayiuse(cpu::x64::avx2)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>(jcp));
-        blk_size = 8;
-    } else if (mayiuse(cpu::x64::sse41)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>(jcp));
+    } else if (mayiuse(cpu::x64::avx2) || mayiuse(cpu::x64::sse41)) {
         blk_size = 8;
     }
 
-    if (reduce_kernel)
-        reduce_kernel->create_ker();
-
-    if (reduce_post_kernel)
-        reduce_post_kernel->create_ker();
-
     jit_mode = jit_mode && reduce_kernel;
 }
 
@@ -256,6 +256,21 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNReorderNode::rebindMemory(const std::unordered_map<void*, MKLDNNMemoryPtr>& memoryMap) {
+    MKLDNNNode::rebindMemory(memoryMap);
+
+    // execute() points the blocked memory to the edges, so the copy must not share it with the original node
+    auto copyMemory = [this](MKLDNNMemoryPtr& memory, const MKLDNNMemoryPtr& edgeMemory) {
+        if (!memory)
+            return;
+        auto copy = std::make_shared<MKLDNNMemory>(getEngine());
+        copy->Create(memory->GetDescriptor(), edgeMemory->GetPrimitive().get_data_handle(), false);
+        memory = copy;
+    };
+    copyMemory(src_blocked, getParentEdgeAt(0)->getMemoryPtr());
+    copyMemory(dst_blocked, getChildEdgeAt(0)->getMemoryPtr());
+}
+
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
     if (prim) {
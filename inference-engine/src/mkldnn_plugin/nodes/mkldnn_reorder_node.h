@@ -22,6 +22,12 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNReorderNode(*this));
+    }
+    void rebindMemory(const std::unordered_map<void*, MKLDNNMemoryPtr>& memoryMap) override;
+
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
 
     void setDescs(const InferenceEngine::TensorDesc& input, const InferenceEngine::TensorDesc& output) {
@@ -48,6 +54,8 @@ public:
     InferenceEngine::Blob::Ptr _scales;
 
 private:
+    MKLDNNReorderNode(const MKLDNNReorderNode&) = default;
+
     InferenceEngine::TensorDesc input;
     InferenceEngine::TensorDesc output;
 
@@ -24,7 +24,13 @@ public:
     void createPrimitive() override;
     bool created() const override;
 
+    MKLDNNNodePtr clone() const override {
+        return MKLDNNNodePtr(new MKLDNNSoftMaxNode(*this));
+    }
+
 private:
+    MKLDNNSoftMaxNode(const MKLDNNSoftMaxNode&) = default;
+
     int axis = 0;
 };
 
@@ -133,7 +133,15 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
             // at least the plain layout can be optimized inplace.
             pdIndexesToReuse.emplace_back(supportedPrimitiveDescriptors.size() - 1);
         } else if (itr->first == TensorDescCreatorTypes::nCsp8c || itr->first == TensorDescCreatorTypes::nCsp16c) {
-            if (axis < 2) {
+            // the outputs share the input strides, so along a spatial axis they are dense only if all the outer
+            // dimensions but the batch are 1, the consumers would fall back to the reference kernels otherwise
+            const auto& blkDims = supportedPrimitiveDescriptors.back().getConfig().inConfs[0].desc.getBlockingDesc().getBlockDims();
+            bool dense = true;
+            for (size_t i = 1; i < axis; i++) {
+                if (blkDims[i] != 1)
+                    dense = false;
+            }
+            if (dense) {
                 pdIndexesToReuse.emplace_back(supportedPrimitiveDescriptors.size() - 1);
             }
         }
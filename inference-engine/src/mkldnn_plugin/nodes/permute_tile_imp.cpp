@@ -0,0 +1,165 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "permute_tile_imp.hpp"
+
+#include <algorithm>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// 64 x 64 block of 4 byte elements takes 16 KB for both the source and the destination lines, so it stays in L1
+constexpr size_t block_size = 64;
+
+template <typename T>
+void transpose_scalar(const T* src, T* dst, size_t rows, size_t cols, size_t src_ld, size_t dst_ld) {
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++)
+            dst[c * dst_ld + r] = src[r * src_ld + c];
+    }
+}
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+constexpr size_t tile_32 = 8;
+
+inline void transpose_tile(const float* src, float* dst, size_t src_ld, size_t dst_ld) {
+    const __m256 r0 = _mm256_loadu_ps(src + 0 * src_ld), r1 = _mm256_loadu_ps(src + 1 * src_ld);
+    const __m256 r2 = _mm256_loadu_ps(src + 2 * src_ld), r3 = _mm256_loadu_ps(src + 3 * src_ld);
+    const __m256 r4 = _mm256_loadu_ps(src + 4 * src_ld), r5 = _mm256_loadu_ps(src + 5 * src_ld);
+    const __m256 r6 = _mm256_loadu_ps(src + 6 * src_ld), r7 = _mm256_loadu_ps(src + 7 * src_ld);
+
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+    const __m256 t4 = _mm256_unpacklo_ps(r4, r5), t5 = _mm256_unpackhi_ps(r4, r5);
+    const __m256 t6 = _mm256_unpacklo_ps(r6, r7), t7 = _mm256_unpackhi_ps(r6, r7);
+
+    const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps(dst + 0 * dst_ld, _mm256_permute2f128_ps(s0, s4, 0x20));
+    _mm256_storeu_ps(dst + 1 * dst_ld, _mm256_permute2f128_ps(s1, s5, 0x20));
+    _mm256_storeu_ps(dst + 2 * dst_ld, _mm256_permute2f128_ps(s2, s6, 0x20));
+    _mm256_storeu_ps(dst + 3 * dst_ld, _mm256_permute2f128_ps(s3, s7, 0x20));
+    _mm256_storeu_ps(dst + 4 * dst_ld, _mm256_permute2f128_ps(s0, s4, 0x31));
+    _mm256_storeu_ps(dst + 5 * dst_ld, _mm256_permute2f128_ps(s1, s5, 0x31));
+    _mm256_storeu_ps(dst + 6 * dst_ld, _mm256_permute2f128_ps(s2, s6, 0x31));
+    _mm256_storeu_ps(dst + 7 * dst_ld, _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+#elif defined(HAVE_SSE42)
+constexpr size_t tile_32 = 4;
+
+inline void transpose_tile(const float* src, float* dst, size_t src_ld, size_t dst_ld) {
+    __m128 r0 = _mm_loadu_ps(src + 0 * src_ld), r1 = _mm_loadu_ps(src + 1 * src_ld);
+    __m128 r2 = _mm_loadu_ps(src + 2 * src_ld), r3 = _mm_loadu_ps(src + 3 * src_ld);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(dst + 0 * dst_ld, r0);
+    _mm_storeu_ps(dst + 1 * dst_ld, r1);
+    _mm_storeu_ps(dst + 2 * dst_ld, r2);
+    _mm_storeu_ps(dst + 3 * dst_ld, r3);
+}
+#endif
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+constexpr size_t tile_16 = 8;
+
+inline void transpose_tile(const uint16_t* src, uint16_t* dst, size_t src_ld, size_t dst_ld) {
+    __m128i r[tile_16];
+    for (size_t i = 0; i < tile_16; i++)
+        r[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * src_ld));
+
+    const __m128i b0 = _mm_unpacklo_epi16(r[0], r[1]), b1 = _mm_unpackhi_epi16(r[0], r[1]);
+    const __m128i b2 = _mm_unpacklo_epi16(r[2], r[3]), b3 = _mm_unpackhi_epi16(r[2], r[3]);
+    const __m128i b4 = _mm_unpacklo_epi16(r[4], r[5]), b5 = _mm_unpackhi_epi16(r[4], r[5]);
+    const __m128i b6 = _mm_unpacklo_epi16(r[6], r[7]), b7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+    const __m128i c0 = _mm_unpacklo_epi32(b0, b2), c1 = _mm_unpackhi_epi32(b0, b2);
+    const __m128i c2 = _mm_unpacklo_epi32(b1, b3), c3 = _mm_unpackhi_epi32(b1, b3);
+    const __m128i c4 = _mm_unpacklo_epi32(b4, b6), c5 = _mm_unpackhi_epi32(b4, b6);
+    const __m128i c6 = _mm_unpacklo_epi32(b5, b7), c7 = _mm_unpackhi_epi32(b5, b7);
+
+    const __m128i columns[tile_16] = {
+        _mm_unpacklo_epi64(c0, c4), _mm_unpackhi_epi64(c0, c4), _mm_unpacklo_epi64(c1, c5), _mm_unpackhi_epi64(c1, c5),
+        _mm_unpacklo_epi64(c2, c6), _mm_unpackhi_epi64(c2, c6), _mm_unpacklo_epi64(c3, c7), _mm_unpackhi_epi64(c3, c7),
+    };
+    for (size_t i = 0; i < tile_16; i++)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * dst_ld), columns[i]);
+}
+
+// Full tiles of the block are transposed in registers, the edges which are narrower than a tile are copied one by one
+template <typename T, size_t tile>
+void transpose_block(const T* src, T* dst, size_t rows, size_t cols, size_t src_ld, size_t dst_ld) {
+    const size_t full_rows = rows - rows % tile, full_cols = cols - cols % tile;
+    for (size_t r = 0; r < full_rows; r += tile) {
+        for (size_t c = 0; c < full_cols; c += tile)
+            transpose_tile(src + r * src_ld + c, dst + c * dst_ld + r, src_ld, dst_ld);
+    }
+    transpose_scalar(src + full_cols, dst + full_cols * dst_ld, full_rows, cols - full_cols, src_ld, dst_ld);
+    transpose_scalar(src + full_rows * src_ld, dst + full_rows, rows - full_rows, cols, src_ld, dst_ld);
+}
+#endif
+
+template <typename T>
+void transpose_blocks(const T* src, T* dst, size_t rows, size_t cols, size_t src_ld, size_t dst_ld) {
+    for (size_t r = 0; r < rows; r += block_size) {
+        for (size_t c = 0; c < cols; c += block_size) {
+            const T* block_src = src + r * src_ld + c;
+            T* block_dst = dst + c * dst_ld + r;
+            const size_t block_rows = std::min(block_size, rows - r), block_cols = std::min(block_size, cols - c);
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            if (sizeof(T) == 4) {
+                transpose_block<float, tile_32>(reinterpret_cast<const float*>(block_src),
+                                                reinterpret_cast<float*>(block_dst), block_rows, block_cols, src_ld, dst_ld);
+                continue;
+            }
+            if (sizeof(T) == 2) {
+                transpose_block<uint16_t, tile_16>(reinterpret_cast<const uint16_t*>(block_src),
+                                                   reinterpret_cast<uint16_t*>(block_dst), block_rows, block_cols, src_ld, dst_ld);
+                continue;
+            }
+#endif
+            transpose_scalar(block_src, block_dst, block_rows, block_cols, src_ld, dst_ld);
+        }
+    }
+}
+
+}  // namespace
+
+void transpose_2d(const uint8_t* src, uint8_t* dst, size_t rows, size_t cols, size_t src_ld, size_t dst_ld,
+                  size_t data_size) {
+    switch (data_size) {
+        case 4:
+            transpose_blocks(reinterpret_cast<const uint32_t*>(src), reinterpret_cast<uint32_t*>(dst), rows, cols, src_ld, dst_ld);
+            break;
+        case 2:
+            transpose_blocks(reinterpret_cast<const uint16_t*>(src), reinterpret_cast<uint16_t*>(dst), rows, cols, src_ld, dst_ld);
+            break;
+        case 1:
+            transpose_blocks(src, dst, rows, cols, src_ld, dst_ld);
+            break;
+        default:
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t c = 0; c < cols; c++)
+                    std::memcpy(dst + (c * dst_ld + r) * data_size, src + (r * src_ld + c) * data_size, data_size);
+            }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
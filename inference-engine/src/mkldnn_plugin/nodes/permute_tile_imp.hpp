@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+// Transposes the rows x cols matrix of data_size bytes elements: dst[c * dst_ld + r] = src[r * src_ld + c], leading
+// dimensions are given in elements. The matrix is walked by cache blocks, and inside of a block 4 byte elements are
+// transposed in registers by 8x8 (4x4 for SSE4.2) tiles and 2 byte elements by 8x8 tiles.
+void transpose_2d(const uint8_t* src, uint8_t* dst, size_t rows, size_t cols, size_t src_ld, size_t dst_ld,
+                  size_t data_size);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
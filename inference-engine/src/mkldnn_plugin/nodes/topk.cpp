@@ -4,6 +4,7 @@
 
 #include "base.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <cfloat>
@@ -445,6 +446,100 @@ public:
         });
     }
 
+    struct topk_element {
+        float value;
+        int index;
+    };
+
+    /**
+     * Keeps the best elements of a row in a heap with the worst of them on the top, so an element which doesn't make
+     * it to the top k costs one comparison and the rest cost O(log k). When there are fewer rows than threads,
+     * the rows are split into parts, every part selects its own top k and the candidates of the parts are merged.
+     */
+    template <template <typename> class Compare>
+    void topk_select(const float* src_data, float* dst_data, int* dst_idx, int after_num) {
+        const int rows = before_num * after_num;
+        int parts = 1;
+        if (rows < parallel_get_max_threads())
+            parts = std::max(1, std::min(parallel_get_max_threads() / rows, dim / min_part_len));
+
+        // equal values are ordered by their indices like in the insertion based implementation,
+        // NaN is the largest value, otherwise the ordering is not strict and the heap algorithms may go out of bounds
+        auto better = [](const topk_element& a, const topk_element& b) {
+            const bool a_nan = std::isnan(a.value);
+            const bool b_nan = std::isnan(b.value);
+            if (a_nan != b_nan)
+                return a_nan == Compare<float>()(1.f, 0.f);
+            if (a_nan)
+                return a.index < b.index;
+            return Compare<float>()(a.value, b.value) || (a.value == b.value && a.index < b.index);
+        };
+
+        auto select = [&](int row, int start, int end, std::vector<topk_element>& heap) {
+            const float* row_data = src_data + (row / after_num) * dim * after_num + row % after_num;
+            heap.clear();
+            for (int i2 = start; i2 < end; i2++) {
+                const topk_element element = {row_data[i2 * after_num], i2};
+                if (static_cast<int>(heap.size()) < src_k) {
+                    heap.push_back(element);
+                    std::push_heap(heap.begin(), heap.end(), better);
+                } else if (better(element, heap.front())) {
+                    std::pop_heap(heap.begin(), heap.end(), better);
+                    heap.back() = element;
+                    std::push_heap(heap.begin(), heap.end(), better);
+                }
+            }
+        };
+
+        auto store = [&](int row, std::vector<topk_element>& top) {
+            if (sort_value) {
+                std::sort(top.begin(), top.end(), better);
+            } else {
+                std::sort(top.begin(), top.end(), [](const topk_element& a, const topk_element& b) {
+                    return a.index < b.index;
+                });
+            }
+            const int i0 = row / after_num;
+            const int i1 = row % after_num;
+            for (int i2 = 0; i2 < src_k; i2++) {
+                const int d_index = (i0 * src_k + i2) * after_num + i1;
+                if (dst_data)
+                    dst_data[d_index] = top[i2].value;
+                if (dst_idx)
+                    dst_idx[d_index] = top[i2].index;
+            }
+        };
+
+        if (parts == 1) {
+            parallel_for(rows, [&](int row) {
+                std::vector<topk_element> heap;
+                heap.reserve(src_k);
+                select(row, 0, dim, heap);
+                store(row, heap);
+            });
+            return;
+        }
+
+        std::vector<std::vector<topk_element>> candidates(rows * parts);
+        parallel_for(rows * parts, [&](int work) {
+            const int row = work / parts;
+            const int part = work % parts;
+            const int start = static_cast<int>(static_cast<int64_t>(dim) * part / parts);
+            const int end = static_cast<int>(static_cast<int64_t>(dim) * (part + 1) / parts);
+            candidates[work].reserve(src_k);
+            select(row, start, end, candidates[work]);
+        });
+        parallel_for(rows, [&](int row) {
+            std::vector<topk_element> top;
+            top.reserve(src_k * parts);
+            for (int part = 0; part < parts; part++)
+                top.insert(top.end(), candidates[row * parts + part].begin(), candidates[row * parts + part].end());
+            std::nth_element(top.begin(), top.begin() + (src_k - 1), top.end(), better);
+            top.resize(src_k);
+            store(row, top);
+        });
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -499,7 +594,17 @@ public:
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
-        if (src_k == 1) {
+        const int after_num = count(in_dims, axis + 1, in_dims.size());
+        // nothing to select from an empty tensor, the outputs are empty as well
+        if (before_num == 0 || after_num == 0 || src_k == 0)
+            return OK;
+        const bool split_rows = before_num * after_num < parallel_get_max_threads() && dim >= 2 * min_part_len;
+        if (src_k > insertion_max_k || split_rows) {
+            if (mode_max)
+                topk_select<std::greater>(src, dst_data, dst_idx, after_num);
+            else
+                topk_select<std::less>(src, dst_data, dst_idx, after_num);
+        } else if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
                     top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -545,6 +650,11 @@ private:
     bool sort_value = false;
     bool mode_max = true;
 
+    // the largest k kept in the sorted array with insertions, larger ones are selected with the heap
+    const int insertion_max_k = 32;
+    // the shortest part of a row which is worth a separate thread
+    const int min_part_len = 16384;
+
     int dim, before_num;
 
 #if defined(HAVE_AVX512F)
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages.hpp"
+#include "numa_memory.hpp"
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#if defined(__linux__)
+namespace {
+
+std::shared_ptr<void> mapped(void* ptr, size_t size) {
+    return std::shared_ptr<void>(ptr, [size](void* p) { munmap(p, size); });
+}
+
+// Binds the untouched mapping to the node. If the binding is refused, the calling thread, which is pinned to the node
+// of its stream, faults the pages in: a single write per huge page is enough, the kernel zeroes the page anyway.
+void placeOnNumaNode(void* ptr, size_t size, int numaNodeId) {
+    if (numaNodeId < 0 || bindToNumaNode(ptr, size, numaNodeId))
+        return;
+    auto data = static_cast<volatile char*>(ptr);
+    for (size_t offset = 0; offset < size; offset += hugePageSize)
+        data[offset] = 0;
+}
+
+std::shared_ptr<void> allocateExplicitHugePages(size_t size, int numaNodeId) {
+#if defined(MAP_HUGETLB)
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    if (numaNodeId >= 0 && !bindToNumaNode(ptr, size, numaNodeId)) {
+        // populated right away by the calling thread instead of the first inference
+        munmap(ptr, size);
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+    }
+    return mapped(ptr, size);
+#else
+    return nullptr;
+#endif
+}
+
+std::shared_ptr<void> allocateTransparentHugePages(size_t size, int numaNodeId) {
+#if defined(MADV_HUGEPAGE)
+    // Over-allocate to cut a 2 MB aligned range out of the mapping, THP can back only aligned ranges
+    const size_t mappedSize = size + hugePageSize;
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t aligned = (begin + hugePageSize - 1) / hugePageSize * hugePageSize;
+    const size_t head = aligned - begin;
+    const size_t tail = mappedSize - head - size;
+    if (head)
+        munmap(ptr, head);
+    if (tail)
+        munmap(reinterpret_cast<void*>(aligned + size), tail);
+
+    if (madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE) != 0) {
+        munmap(reinterpret_cast<void*>(aligned), size);
+        return nullptr;
+    }
+    placeOnNumaNode(reinterpret_cast<void*>(aligned), size, numaNodeId);
+    return mapped(reinterpret_cast<void*>(aligned), size);
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace
+#endif
+
+std::shared_ptr<void> allocateHugePages(size_t size, int numaNodeId) {
+    // Smaller buffers would waste most of the huge page
+    if (size < hugePageSize)
+        return nullptr;
+#if defined(__linux__)
+    const size_t alignedSize = (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+    if (auto buffer = allocateExplicitHugePages(alignedSize, numaNodeId))
+        return buffer;
+    return allocateTransparentHugePages(alignedSize, numaNodeId);
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+/**
+ * @brief Allocates zero-initialized buffer backed with 2 MB huge pages.
+ * Explicit huge pages (hugetlbfs pool) are tried first, then transparent huge pages are requested for a 2 MB aligned
+ * anonymous mapping.
+ * The pages are placed on the NUMA node before any of them is faulted in: the whole mapping is bound to the node,
+ * huge page mappings can't be bound by parts. If the binding is refused, the mapping is populated by the calling thread.
+ * @param size size of the buffer in bytes
+ * @param numaNodeId NUMA node to place the pages on, negative value means no preference
+ * @return the buffer or nullptr if the size is less than a huge page or huge pages are not supported by OS,
+ * so the caller should fall back to the regular allocation
+ */
+std::shared_ptr<void> allocateHugePages(size_t size, int numaNodeId = -1);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,151 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Byte representation of the parameters a JIT kernel is generated from.
+ * Parameter structs have padding and non-trivial members, so the fields are appended one by one.
+ */
+class JitKernelKey {
+public:
+    template <typename T>
+    JitKernelKey& operator<<(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "JitKernelKey accepts only trivially copyable values");
+        data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        return *this;
+    }
+
+    template <typename T>
+    JitKernelKey& operator<<(const std::vector<T>& values) {
+        *this << values.size();
+        for (const auto& value : values)
+            *this << value;
+        return *this;
+    }
+
+    const std::string& str() const {
+        return data;
+    }
+
+private:
+    std::string data;
+};
+
+/**
+ * @brief Process-wide cache of generated JIT kernels of one type.
+ * Identical nodes of a network and of different networks get the same kernel instance, so the code is generated once.
+ * The kernels must not keep any per node state used at execution time.
+ */
+template <typename Kernel>
+class JitKernelCache {
+public:
+    using KernelPtr = std::shared_ptr<Kernel>;
+
+    /**
+     * @brief Returns the kernel generated for the key, calls the builder if there is no such kernel yet.
+     * Concurrent requests of the same key wait for the single builder call instead of generating the code twice.
+     * @param key parameters the kernel is generated from
+     * @param builder callable returning KernelPtr with the code already generated
+     */
+    template <typename Builder>
+    static KernelPtr getOrCreate(const JitKernelKey& key, Builder builder) {
+        auto& cache = instance();
+        std::promise<KernelPtr> promise;
+        std::shared_future<KernelPtr> kernel;
+        {
+            std::lock_guard<std::mutex> lock(cache.guard);
+            auto found = cache.kernels.find(key.str());
+            if (found != cache.kernels.end()) {
+                kernel = found->second;
+            } else {
+                cache.kernels.emplace(key.str(), promise.get_future().share());
+                cache.order.push_back(key.str());
+            }
+        }
+        // rethrows the exception of the builder call another thread waits for
+        if (kernel.valid())
+            return kernel.get();
+
+        KernelPtr created;
+        try {
+            created = builder();
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(cache.guard);
+                cache.forget(key.str());
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+        promise.set_value(created);
+
+        std::lock_guard<std::mutex> lock(cache.guard);
+        while (cache.order.size() > capacity) {
+            auto oldest = cache.order.front();
+            cache.forget(oldest);
+        }
+        return created;
+    }
+
+    /**
+     * @brief Number of the kernels kept by the cache, including the ones being generated
+     */
+    static size_t size() {
+        auto& cache = instance();
+        std::lock_guard<std::mutex> lock(cache.guard);
+        return cache.kernels.size();
+    }
+
+    /**
+     * @brief Drops all the kernels, the ones being used by the nodes stay alive until the nodes are destroyed
+     */
+    static void clear() {
+        auto& cache = instance();
+        std::lock_guard<std::mutex> lock(cache.guard);
+        cache.kernels.clear();
+        cache.order.clear();
+    }
+
+    // The oldest kernels are dropped above the limit, nodes which use them keep their own references
+    static constexpr size_t capacity = 1024;
+
+private:
+    static JitKernelCache& instance() {
+        static JitKernelCache cache;
+        return cache;
+    }
+
+    void forget(const std::string& key) {
+        kernels.erase(key);
+        for (auto it = order.begin(); it != order.end(); ++it) {
+            if (*it == key) {
+                order.erase(it);
+                break;
+            }
+        }
+    }
+
+    std::mutex guard;
+    std::map<std::string, std::shared_future<KernelPtr>> kernels;
+    std::deque<std::string> order;
+};
+
+template <typename Kernel>
+constexpr size_t JitKernelCache<Kernel>::capacity;
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.hpp"
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+#if defined(__linux__)
+// Values from <linux/mempolicy.h>, the header is not always available in the build environment
+constexpr int MPOL_PREFERRED_MODE = 1;
+constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+#endif
+
+size_t pageSize() {
+#if defined(__linux__)
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+bool isMultiNumaSystem() {
+    static const bool multiNuma = InferenceEngine::getAvailableNUMANodes().size() > 1;
+    return multiNuma;
+}
+
+}  // namespace
+
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    if (ptr == nullptr || numaNodeId < 0 || !isMultiNumaSystem())
+        return false;
+#if defined(__linux__) && defined(SYS_mbind)
+    const uintptr_t page = pageSize();
+    const uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) / page * page;
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size) / page * page;
+    if (begin >= end)
+        return false;
+
+    const size_t bitsPerWord = sizeof(unsigned long) * 8;  // NOLINT
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerWord + 1, 0);  // NOLINT
+    nodeMask[numaNodeId / bitsPerWord] |= 1ul << (numaNodeId % bitsPerWord);
+
+    return 0 == syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED_MODE,
+                        nodeMask.data(), nodeMask.size() * bitsPerWord + 1, MPOL_MF_MOVE_FLAG);
+#else
+    return false;
+#endif
+}
+
+void firstTouch(void* ptr, size_t size) {
+    if (ptr == nullptr || size == 0)
+        return;
+    const size_t page = pageSize();
+    auto data = static_cast<uint8_t*>(ptr);
+    InferenceEngine::parallel_for((size + page - 1) / page, [&](size_t i) {
+        std::memset(data + i * page, 0, std::min(page, size - i * page));
+    });
+}
+
+void getNumaPlacement(const void* ptr, size_t size, std::map<int, size_t>& placement) {
+    if (ptr == nullptr || size == 0)
+        return;
+#if defined(__linux__) && defined(SYS_move_pages)
+    const uintptr_t page = pageSize();
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(ptr) / page * page;
+    const uintptr_t end = reinterpret_cast<uintptr_t>(ptr) + size;
+
+    std::vector<void*> pages;
+    for (uintptr_t p = begin; p < end; p += page)
+        pages.push_back(reinterpret_cast<void*>(p));
+    std::vector<int> status(pages.size(), -1);
+
+    // Passing no target nodes makes move_pages report the current node of each page without moving it
+    if (0 != syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0)) {
+        placement[-1] += size;
+        return;
+    }
+    for (size_t i = 0; i < pages.size(); i++) {
+        const uintptr_t pageBegin = std::max(reinterpret_cast<uintptr_t>(pages[i]), reinterpret_cast<uintptr_t>(ptr));
+        const uintptr_t pageEnd = std::min(reinterpret_cast<uintptr_t>(pages[i]) + page, end);
+        placement[status[i] < 0 ? -1 : status[i]] += pageEnd - pageBegin;
+    }
+#else
+    placement[-1] += size;
+#endif
+}
+
+}  // namespace MKLDNNPlugin
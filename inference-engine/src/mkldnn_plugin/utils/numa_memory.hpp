@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Sets preferred NUMA node for the pages of the buffer and migrates already touched pages there.
+ * Only the pages which lie completely inside the buffer are affected, so neighbour allocations keep their placement.
+ * @param ptr pointer to the buffer
+ * @param size size of the buffer in bytes
+ * @param numaNodeId NUMA node id, negative value means no preference
+ * @return true if the placement was applied, false if it is not supported by OS or not needed (single NUMA node system)
+ */
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId);
+
+/**
+ * @brief Touches each page of the buffer from the threads of current arena, so the OS places them on the NUMA node
+ * the threads are pinned to. Content of the buffer is zeroed.
+ * @param ptr pointer to the buffer
+ * @param size size of the buffer in bytes
+ */
+void firstTouch(void* ptr, size_t size);
+
+/**
+ * @brief Collects the NUMA nodes the pages of the buffer reside on
+ * @param ptr pointer to the buffer
+ * @param size size of the buffer in bytes
+ * @param placement map from NUMA node id to amount of bytes which are placed on the node. Pages which are not touched yet
+ * or can't be queried are accounted for -1 node.
+ */
+void getNumaPlacement(const void* ptr, size_t size, std::map<int, size_t>& placement);
+
+}  // namespace MKLDNNPlugin
@@ -205,12 +205,24 @@ public:
     }
 
     void StartAsync() override {
-        InferImpl([&] {StartAsync_ThreadUnsafe();});
+        StartAsyncWithPriority(TaskPriority{});
+    }
+
+    void StartAsyncWithPriority(const TaskPriority& priority) override {
+        // the hints are set only once the request is switched to the busy state,
+        // so a concurrent start can't change the priority of the running pipeline
+        InferImpl([&] {
+            _taskPriority = priority;
+            StartAsync_ThreadUnsafe();
+        });
     }
 
     void Infer() override {
         DisableCallbackGuard disableCallbackGuard{this};
-        InferImpl([&] {Infer_ThreadUnsafe();});
+        InferImpl([&] {
+            _taskPriority = {};
+            Infer_ThreadUnsafe();
+        });
         Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
     }
 
@@ -289,7 +301,7 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        firstStageExecutor->runWithPriority(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)), _taskPriority);
     }
 
     /**
@@ -375,7 +387,7 @@ private:
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->runWithPriority(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)), _taskPriority);
                 }
             } catch (...) {
                 currentException = std::current_exception();
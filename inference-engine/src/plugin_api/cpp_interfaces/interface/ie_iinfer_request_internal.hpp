@@ -9,6 +9,7 @@
 #include <ie_preprocess_data.hpp>
 #include <ie_input_info.hpp>
 #include <cpp/ie_infer_request.hpp>
+#include <threading/ie_itask_executor.hpp>
 
 #include <map>
 #include <memory>
@@ -117,6 +118,14 @@ public:
      */
     virtual void StartAsync();
 
+    /**
+     * @brief Start inference of specified input(s) in asynchronous mode with the scheduling hints.
+     * Plugins which schedule requests with streams executors pass them to the executor.
+     * @note The name differs from StartAsync(), so overriding one of them doesn't hide the other
+     * @param priority The scheduling hints
+     */
+    virtual void StartAsyncWithPriority(const TaskPriority& priority);
+
     /**
      * @brief The minimal asynchronous inference function to be implemented by plugins.
      * It starts inference of specified input(s) in asynchronous mode
@@ -210,6 +219,7 @@ protected:
     InferenceEngine::BlobMap _outputs;  //!< A map of user passed blobs for network outputs
     std::map<std::string, PreProcessDataPtr> _preProcData;        //!< A map of pre-process data per input
     int m_curBatch = -1;  //!< Current batch value used in dynamic batching
+    TaskPriority _taskPriority;  //!< Scheduling hints for asynchronous inference
 
     /**
      * @brief A shared pointer to ExecutableNetworkInternal interface
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -20,7 +21,9 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from per-stream lock-free queues, idle threads steal tasks
+ *        from the queues of other streams and are parked after a short spinning.
+ *        Tasks started with runWithPriority() are scheduled by priority and deadline ahead of the default ones.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -40,8 +43,33 @@ public:
      */
     ~CPUStreamsExecutor() override;
 
+    /**
+     * @brief Queueing delay statistics of the tasks of one priority class
+     */
+    struct QueueingStatistics {
+        std::size_t _tasks = 0;         //!< Number of started tasks
+        double      _totalDelayMs = 0;  //!< Sum of the queueing delays in milliseconds
+        double      _maxDelayMs = 0;    //!< Maximal queueing delay in milliseconds
+    };
+
     void run(Task task) override;
 
+    /**
+     * @brief Starts the task with the scheduling hints. Tasks with higher priority are started first,
+     *        tasks with the same priority are started in the deadline order.
+     *        Priority of the waiting tasks is raised over time, so low priority tasks are not starved.
+     * @param task A task to start
+     * @param priority Scheduling priority and deadline of the task
+     */
+    void runWithPriority(Task task, const TaskPriority& priority) override;
+
+    /**
+     * @brief Returns queueing delay statistics of the tasks started with runWithPriority() with non-default
+     *        priority or a deadline. Default tasks are not accounted to keep their path lock-free
+     * @return Statistics per priority class
+     */
+    std::map<int, QueueingStatistics> GetQueueingStatistics() const;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +25,17 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling hints of a task. Tasks with higher priority are started first, tasks with the same priority
+ *        are ordered by the deadline. Executors which don't support scheduling treat all tasks equally.
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskPriority {
+    using Clock = std::chrono::steady_clock;
+    int                 _priority = 0;                          //!< Priority class, default tasks have zero priority
+    Clock::time_point   _deadline = Clock::time_point::max();   //!< Time point the task should be started before
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -61,6 +73,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context taking into account scheduling hints.
+     *        Default implementation ignores the hints and calls run()
+     * @param task A task to start
+     * @param priority Scheduling priority and deadline of the task
+     */
+    virtual void runWithPriority(Task task, const TaskPriority& priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
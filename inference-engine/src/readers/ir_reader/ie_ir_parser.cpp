@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <exception>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -28,6 +29,7 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -545,7 +547,7 @@ void XmlDeserializer::on_adapter(
 
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root, const Blob::CPtr& weights) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "ParseLayers");
 
     struct FunctionNodes {
         ngraph::ParameterVector parameters;
@@ -567,18 +569,38 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
-    // Read all layers and store their parameters in params map
+    // Parse layers in parallel, pugixml document is safe for concurrent reading.
+    // Errors are reported in the layers order, the same way as the sequential parsing does
+    std::vector<pugi::xml_node> layer_nodes;
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layer_nodes.push_back(node);
+    }
+    std::vector<V10Parser::GenericLayerParams> layer_params(layer_nodes.size());
+    std::vector<std::exception_ptr> layer_errors(layer_nodes.size());
+    parallel_for(layer_nodes.size(), [&](size_t i) {
+        try {
+            layer_params[i] = parseGenericParams(layer_nodes[i]);
+        } catch (...) {
+            layer_errors[i] = std::current_exception();
+        }
+    });
+
+    // Store parameters of all layers in params map
+    for (size_t i = 0; i < layer_nodes.size(); i++) {
+        if (layer_errors[i])
+            std::rethrow_exception(layer_errors[i]);
+        auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        params[node_param.layerId] = {layer_nodes[i], std::move(node_param)};
     }
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ParseEdges");
+
     std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
 
@@ -604,6 +626,31 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructConstants");
+
+    // Constants do not depend on other nodes, so they are created in parallel: attributes parsing,
+    // weights sharing and validation of each constant are independent. Other nodes are connected to
+    // their inputs, what modifies the producers, so they are created sequentially in the topological order
+    std::vector<size_t/*layer-id*/> constant_ids;
+    for (auto& layer_id : order) {
+        if (params[layer_id].params.type == "Const" && edges[layer_id].empty())
+            constant_ids.push_back(layer_id);
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> constant_nodes(constant_ids.size());
+    std::vector<std::exception_ptr> constant_errors(constant_ids.size());
+    parallel_for(constant_ids.size(), [&](size_t i) {
+        const auto& p = params.at(constant_ids[i]);
+        try {
+            constant_nodes[i] = createNode({}, p.xml, weights, p.params);
+        } catch (...) {
+            constant_errors[i] = std::current_exception();
+        }
+    });
+    std::map<size_t/*layer-id*/, size_t/*constant index*/> id_to_constant;
+    for (size_t i = 0; i < constant_ids.size(); i++) {
+        id_to_constant[constant_ids[i]] = i;
+    }
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
@@ -629,7 +676,15 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        std::shared_ptr<ngraph::Node> node;
+        auto constant = id_to_constant.find(layer_id);
+        if (constant != id_to_constant.end()) {
+            if (constant_errors[constant->second])
+                std::rethrow_exception(constant_errors[constant->second]);
+            node = constant_nodes[constant->second];
+        } else {
+            node = createNode(inputs, p.xml, weights, p.params);
+        }
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
@@ -92,22 +92,40 @@ public:
 
     /// \return The strides.
     const Strides& get_strides() const { return m_strides; }
-    void set_strides(const Strides& strides) { m_strides = strides; }
+    void set_strides(const Strides& strides) {
+        m_strides = strides;
+        mark_for_revalidation();
+    }
     /// \return The dilations.
     const Strides& get_dilations() const { return m_dilations; }
-    void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+    void set_dilations(const Strides& dilations) {
+        m_dilations = dilations;
+        mark_for_revalidation();
+    }
     /// \return The padding-below sizes (possibly negative).
     const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-    void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+    void set_pads_begin(const CoordinateDiff& pads_begin) {
+        m_pads_begin = pads_begin;
+        mark_for_revalidation();
+    }
     /// \return The padding-above sizes (possibly negative).
     const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-    void set_adding_above(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+    void set_adding_above(const CoordinateDiff& pads_end) {
+        m_pads_end = pads_end;
+        mark_for_revalidation();
+    }
     /// \return The pad type for convolution.
     const PadType& get_auto_pad() const { return m_auto_pad; }
-    void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+    void set_auto_pad(const PadType& auto_pad) {
+        m_auto_pad = auto_pad;
+        mark_for_revalidation();
+    }
     /// \return The groups for convolution.
     const size_t& get_group() const { return m_group; }
-    void set_group(const size_t & group) { m_group = group; }
+    void set_group(const size_t & group) {
+        m_group = group;
+        mark_for_revalidation();
+    }
 
 protected:
     Strides m_strides;
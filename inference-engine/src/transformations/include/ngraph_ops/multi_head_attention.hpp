@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+namespace internal {
+
+/**
+ * @brief Scaled dot-product attention of all the heads: Softmax(scale * Q x K^T + mask) x V
+ *
+ * Inputs:
+ *   - query [batch, heads, query_length, head_size]
+ *   - key [batch, heads, key_length, head_size], or [batch, heads, head_size, key_length] if k_transposed is set
+ *   - value [batch, heads, key_length, value_head_size]
+ *   - optional additive mask, numpy-broadcastable to [batch, heads, query_length, key_length]
+ *
+ * Output: [batch, heads, query_length, value_head_size]
+ */
+class TRANSFORMATIONS_API MultiHeadAttention : public Op {
+public:
+    static constexpr NodeTypeInfo type_info{"MultiHeadAttention", 0};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    MultiHeadAttention(const Output<Node>& query,
+                       const Output<Node>& key,
+                       const Output<Node>& value,
+                       float scale,
+                       bool k_transposed);
+
+    MultiHeadAttention(const Output<Node>& query,
+                       const Output<Node>& key,
+                       const Output<Node>& value,
+                       const Output<Node>& mask,
+                       float scale,
+                       bool k_transposed);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector & new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_k_transposed() const { return m_k_transposed; }
+
+private:
+    float m_scale;
+    bool m_k_transposed;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ngraph
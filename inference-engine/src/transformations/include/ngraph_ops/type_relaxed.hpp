@@ -55,6 +55,7 @@ public:
             m_output_data_types.resize(outputIndex + 1, element::undefined);
         }
         m_output_data_types[outputIndex] = element_type;
+        on_overridden_type_changed();
     }
 
     /// \return Data type that will be set for input when original shape/type inference function is called.
@@ -77,9 +78,13 @@ public:
             m_input_data_types.resize(inputIndex + 1, element::undefined);
         }
         m_input_data_types[inputIndex] = element_type;
+        on_overridden_type_changed();
     }
 
 protected:
+    /// Called by the setters above, the operation marks itself for revalidation
+    virtual void on_overridden_type_changed() {}
+
     // Data types that are used for parent shape/type infer function input ports
     // to infer output data types
     element::TypeVector m_input_data_types;
@@ -164,6 +169,11 @@ public:
 
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
 
+protected:
+    void on_overridden_type_changed() override {
+        BaseOp::mark_for_revalidation();
+    }
+
 private:
     void init() {
         validate_and_infer_types();
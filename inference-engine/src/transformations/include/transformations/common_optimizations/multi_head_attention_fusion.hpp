@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API MultiHeadAttentionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MultiHeadAttentionFusion transformation replaces the scaled dot-product attention of transformer models:
+ *
+ *   MatMul(Q, K) -> [Multiply or Divide by scalar] -> [Add mask] -> Softmax -> MatMul(..., V)
+ *
+ * with a single ngraph::op::internal::MultiHeadAttention operation, so a plugin can compute it
+ * without materializing the attention scores.
+ *
+ * Restrictions:
+ *   - Q, K and V are 4D tensors with static rank, the first MatMul has no transpose_a and the second one has
+ *     neither transpose_a nor transpose_b
+ *   - Softmax is applied to the last axis
+ *   - the scale is a scalar constant, the mask is numpy-broadcastable to the scores
+ *   - the intermediate tensors have no other consumers
+ *
+ * The transformation is disabled by default, a plugin enables it when it has an implementation of the operation.
+ */
+
+class ngraph::pass::MultiHeadAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MultiHeadAttentionFusion();
+};
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "ngraph_ops/multi_head_attention.hpp"
+#include "itt.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::internal::MultiHeadAttention::type_info;
+
+op::internal::MultiHeadAttention::MultiHeadAttention(const Output<Node>& query,
+                                                     const Output<Node>& key,
+                                                     const Output<Node>& value,
+                                                     float scale,
+                                                     bool k_transposed)
+        : Op({query, key, value}), m_scale(scale), m_k_transposed(k_transposed) {
+    constructor_validate_and_infer_types();
+}
+
+op::internal::MultiHeadAttention::MultiHeadAttention(const Output<Node>& query,
+                                                     const Output<Node>& key,
+                                                     const Output<Node>& value,
+                                                     const Output<Node>& mask,
+                                                     float scale,
+                                                     bool k_transposed)
+        : Op({query, key, value, mask}), m_scale(scale), m_k_transposed(k_transposed) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> op::internal::MultiHeadAttention::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_clone_with_new_inputs);
+    if (new_args.size() == 4) {
+        return make_shared<MultiHeadAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                               m_scale, m_k_transposed);
+    } else if (new_args.size() == 3) {
+        return make_shared<MultiHeadAttention>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_k_transposed);
+    }
+    throw ngraph::ngraph_error("Unsupported number of inputs: " + std::to_string(new_args.size()));
+}
+
+bool op::internal::MultiHeadAttention::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("k_transposed", m_k_transposed);
+    return true;
+}
+
+void op::internal::MultiHeadAttention::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_validate_and_infer_types);
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this, input_size == 3 || input_size == 4, "Expected 3 or 4 inputs, got: ", input_size);
+
+    auto element_type = get_input_element_type(0);
+    for (size_t i = 1; i < input_size; ++i) {
+        NODE_VALIDATION_CHECK(this, element::Type::merge(element_type, element_type, get_input_element_type(i)),
+                              "Inputs must have the same element type");
+    }
+    NODE_VALIDATION_CHECK(this, element_type.is_dynamic() || element_type.is_real(),
+                          "Inputs must have a floating point element type, got: ", element_type);
+
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& k_shape = get_input_partial_shape(1);
+    const auto& v_shape = get_input_partial_shape(2);
+    for (const auto& shape : {q_shape, k_shape, v_shape}) {
+        NODE_VALIDATION_CHECK(this, shape.rank().compatible(4), "Query, key and value must be 4D tensors, got: ", shape);
+    }
+
+    PartialShape output_shape = PartialShape::dynamic(4);
+    auto key_length = Dimension::dynamic();
+    if (q_shape.rank().is_static()) {
+        output_shape[2] = q_shape[2];
+    }
+    auto merge_dim = [this](Dimension& dst, const Dimension& src, const char* name) {
+        NODE_VALIDATION_CHECK(this, Dimension::merge(dst, dst, src), "Inconsistent ", name, " dimension of the inputs");
+    };
+    auto head_size = Dimension::dynamic();
+    for (const auto& shape : {q_shape, k_shape, v_shape}) {
+        if (shape.rank().is_dynamic())
+            continue;
+        merge_dim(output_shape[0], shape[0], "batch");
+        merge_dim(output_shape[1], shape[1], "heads");
+    }
+    if (q_shape.rank().is_static())
+        merge_dim(head_size, q_shape[3], "head size");
+    if (k_shape.rank().is_static()) {
+        merge_dim(head_size, k_shape[m_k_transposed ? 2 : 3], "head size");
+        merge_dim(key_length, k_shape[m_k_transposed ? 3 : 2], "key length");
+    }
+    if (v_shape.rank().is_static()) {
+        merge_dim(key_length, v_shape[2], "key length");
+        output_shape[3] = v_shape[3];
+    }
+
+    if (input_size == 4) {
+        const auto& mask_shape = get_input_partial_shape(3);
+        PartialShape scores_shape{output_shape[0], output_shape[1], output_shape[2], key_length};
+        NODE_VALIDATION_CHECK(this, mask_shape.rank().is_dynamic() || mask_shape.rank().get_length() <= 4,
+                              "Mask rank must not be greater than 4, got: ", mask_shape);
+        NODE_VALIDATION_CHECK(this, PartialShape::broadcast_merge_into(scores_shape, mask_shape, op::AutoBroadcastType::NUMPY),
+                              "Mask ", mask_shape, " is not broadcastable to the attention scores");
+    }
+
+    set_output_type(0, element_type, output_shape);
+}
@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/multi_head_attention_fusion.hpp"
+#include "ngraph_ops/multi_head_attention.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::MultiHeadAttentionFusion, "MultiHeadAttentionFusion", 0);
+
+namespace {
+
+bool has_single_consumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+bool is_4d(const ngraph::Output<ngraph::Node>& output) {
+    const auto& rank = output.get_partial_shape().rank();
+    return rank.is_static() && rank.get_length() == 4;
+}
+
+// MatMul broadcasts the batch dimensions of its inputs while the fused operation takes per-head tensors as is,
+// so Q [B, H, L, S], K [B, H, Lk, S] (or K^T [B, H, S, Lk]) and V [B, H, Lk, Sv] must match exactly
+bool has_equal_static_dims(const ngraph::Output<ngraph::Node>& query, const ngraph::Output<ngraph::Node>& key,
+                           const ngraph::Output<ngraph::Node>& value, bool k_transposed) {
+    if (query.get_partial_shape().is_dynamic() || key.get_partial_shape().is_dynamic() || value.get_partial_shape().is_dynamic())
+        return false;
+    const auto& q = query.get_shape();
+    const auto& k = key.get_shape();
+    const auto& v = value.get_shape();
+    const size_t k_head_size = k[k_transposed ? 2 : 3];
+    const size_t k_length = k[k_transposed ? 3 : 2];
+    return q[0] == k[0] && q[0] == v[0] &&
+           q[1] == k[1] && q[1] == v[1] &&
+           q[3] == k_head_size &&
+           k_length == v[2];
+}
+
+std::shared_ptr<ngraph::opset1::Constant> get_scalar_constant(const ngraph::Output<ngraph::Node>& output) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return nullptr;
+    return constant;
+}
+
+}  // namespace
+
+ngraph::pass::MultiHeadAttentionFusion::MultiHeadAttentionFusion() {
+    MATCHER_SCOPE(MultiHeadAttentionFusion);
+    auto softmax_pattern = ngraph::pattern::wrap_type<opset1::Softmax>({pattern::any_input(pattern::has_static_rank())},
+                                                                       pattern::consumers_count(1));
+    auto value_pattern = ngraph::pattern::any_input(pattern::has_static_rank());
+    auto matmul_pattern = ngraph::pattern::wrap_type<opset1::MatMul>({softmax_pattern, value_pattern});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        if (transformation_callback(m.get_match_root()))
+            return false;
+
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto matmul_sv = std::dynamic_pointer_cast<opset1::MatMul>(pattern_map.at(matmul_pattern).get_node_shared_ptr());
+        auto softmax = std::dynamic_pointer_cast<opset1::Softmax>(pattern_map.at(softmax_pattern).get_node_shared_ptr());
+        const auto& value = pattern_map.at(value_pattern);
+        if (!matmul_sv || !softmax || matmul_sv->get_transpose_a() || matmul_sv->get_transpose_b() ||
+            !is_4d(value) || !is_4d(softmax->output(0)) || softmax->get_axis() != 3)
+            return false;
+        const auto element_type = softmax->get_output_element_type(0);
+        if (!element_type.is_real())
+            return false;
+
+        NodeVector fused_nodes{softmax, matmul_sv};
+        auto scores = softmax->input_value(0);
+
+        // optional additive mask, either input of Add
+        Output<Node> mask;
+        if (auto add = std::dynamic_pointer_cast<opset1::Add>(scores.get_node_shared_ptr())) {
+            if (!has_single_consumer(add) || add->get_autob().m_type != op::AutoBroadcastType::NUMPY)
+                return false;
+            auto is_scores = [](const std::shared_ptr<Node>& producer) {
+                return is_type<opset1::MatMul>(producer) || is_type<opset1::Multiply>(producer) || is_type<opset1::Divide>(producer);
+            };
+            const size_t scores_idx = is_scores(add->get_input_node_shared_ptr(0)) ? 0 : 1;
+            if (!is_scores(add->get_input_node_shared_ptr(scores_idx)))
+                return false;
+            mask = add->input_value(1 - scores_idx);
+            const auto& mask_rank = mask.get_partial_shape().rank();
+            if (mask_rank.is_dynamic() || mask_rank.get_length() > 4 || mask.get_element_type() != element_type)
+                return false;
+            fused_nodes.push_back(add);
+            scores = add->input_value(scores_idx);
+        }
+
+        // optional scale, multiplication or division by a scalar
+        float scale = 1.f;
+        auto scale_node = scores.get_node_shared_ptr();
+        if (is_type<opset1::Multiply>(scale_node) || is_type<opset1::Divide>(scale_node)) {
+            if (!has_single_consumer(scale_node))
+                return false;
+            const bool is_divide = is_type<opset1::Divide>(scale_node);
+            size_t constant_idx = get_scalar_constant(scale_node->input_value(1)) ? 1 : 0;
+            if (is_divide && constant_idx != 1)
+                return false;
+            auto constant = get_scalar_constant(scale_node->input_value(constant_idx));
+            if (!constant)
+                return false;
+            const float factor = constant->cast_vector<float>()[0];
+            if (is_divide && factor == 0.f)
+                return false;
+            scale = is_divide ? 1.f / factor : factor;
+            fused_nodes.push_back(scale_node);
+            scores = scale_node->input_value(1 - constant_idx);
+        }
+
+        auto matmul_qk = std::dynamic_pointer_cast<opset1::MatMul>(scores.get_node_shared_ptr());
+        if (!matmul_qk || matmul_qk->get_transpose_a() || !has_single_consumer(matmul_qk))
+            return false;
+        const auto query = matmul_qk->input_value(0);
+        const auto key = matmul_qk->input_value(1);
+        // K^T is the second input of the MatMul, the operation takes it either as is or in the original layout
+        const bool k_transposed = !matmul_qk->get_transpose_b();
+        if (!is_4d(query) || !is_4d(key) || !has_equal_static_dims(query, key, value, k_transposed))
+            return false;
+        fused_nodes.push_back(matmul_qk);
+
+        std::shared_ptr<Node> mha;
+        if (mask.get_node_shared_ptr()) {
+            mha = register_new_node<ngraph::op::internal::MultiHeadAttention>(query, key, value, mask, scale, k_transposed);
+        } else {
+            mha = register_new_node<ngraph::op::internal::MultiHeadAttention>(query, key, value, scale, k_transposed);
+        }
+        mha->set_friendly_name(matmul_sv->get_friendly_name());
+        copy_runtime_info(fused_nodes, mha);
+        replace_node(matmul_sv, mha);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_pattern, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -95,3 +95,126 @@ TEST_F(NGraphReaderTests, ReadConstantNetworkWithNegativeDimension) {
 
     EXPECT_THROW(ie.ReadNetwork(model, weights),  std::exception);
 }
+
+TEST_F(NGraphReaderTests, ReadChainOfManyConstantsKeepsConnections) {
+    // constants are created in parallel, each Add must still be connected to its own constant
+    const size_t constantsNum = 512;
+    std::stringstream layers, edges;
+    layers << R"V0G0N(
+        <layer id="0" name="input" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+    size_t previousId = 0;
+    for (size_t i = 0; i < constantsNum; i++) {
+        const size_t constantId = 1 + 2 * i, addId = 2 + 2 * i;
+        layers << R"V0G0N(
+        <layer id=")V0G0N" << constantId << R"V0G0N(" name="constant_)V0G0N" << i << R"V0G0N(" type="Const" version="opset1">
+            <data element_type="f32" offset=")V0G0N" << i * sizeof(float) << R"V0G0N(" shape="1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id=")V0G0N" << addId << R"V0G0N(" name="add_)V0G0N" << i << R"V0G0N(" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << previousId << R"V0G0N(" from-port=")V0G0N" << (previousId ? 2 : 0)
+              << R"V0G0N(" to-layer=")V0G0N" << addId << R"V0G0N(" to-port="0"/>
+        <edge from-layer=")V0G0N" << constantId << R"V0G0N(" from-port="0" to-layer=")V0G0N" << addId << R"V0G0N(" to-port="1"/>)V0G0N";
+        previousId = addId;
+    }
+    const size_t resultId = 1 + 2 * constantsNum;
+    layers << R"V0G0N(
+        <layer id=")V0G0N" << resultId << R"V0G0N(" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </input>
+        </layer>)V0G0N";
+    edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << previousId << R"V0G0N(" from-port="2" to-layer=")V0G0N" << resultId << R"V0G0N(" to-port="0"/>)V0G0N";
+
+    std::string model = "<net name=\"Network\" version=\"10\">\n    <layers>" + layers.str() +
+                        "\n    </layers>\n    <edges>" + edges.str() + "\n    </edges>\n</net>\n";
+
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {constantsNum * sizeof(float)}, Layout::C));
+    weights->allocate();
+    auto data = weights->buffer().as<float*>();
+    for (size_t i = 0; i < constantsNum; i++)
+        data[i] = static_cast<float>(i);
+
+    auto function = ie.ReadNetwork(model, weights).getFunction();
+    ASSERT_NE(nullptr, function);
+    size_t addsNum = 0;
+    for (auto&& op : function->get_ordered_ops()) {
+        if (op->get_friendly_name().find("add_") != 0)
+            continue;
+        auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op->input_value(1).get_node_shared_ptr());
+        ASSERT_NE(nullptr, constant);
+        ASSERT_EQ("constant_" + op->get_friendly_name().substr(4), constant->get_friendly_name());
+        ASSERT_EQ(std::stof(op->get_friendly_name().substr(4)), constant->cast_vector<float>()[0]);
+        addsNum++;
+    }
+    ASSERT_EQ(constantsNum, addsNum);
+}
+
+TEST_F(NGraphReaderTests, ReadNetworkReportsBrokenConstantAmongMany) {
+    std::stringstream layers, edges;
+    const size_t constantsNum = 64;
+    for (size_t i = 0; i < constantsNum; i++) {
+        // the last constant points out of the weights
+        const size_t offset = i + 1 == constantsNum ? constantsNum * sizeof(float) : i * sizeof(float);
+        layers << R"V0G0N(
+        <layer id=")V0G0N" << 2 * i << R"V0G0N(" name="constant_)V0G0N" << i << R"V0G0N(" type="Const" version="opset1">
+            <data element_type="f32" offset=")V0G0N" << offset << R"V0G0N(" shape="1" size="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id=")V0G0N" << 2 * i + 1 << R"V0G0N(" name="output_)V0G0N" << i << R"V0G0N(" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                </port>
+            </input>
+        </layer>)V0G0N";
+        edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << 2 * i << R"V0G0N(" from-port="0" to-layer=")V0G0N" << 2 * i + 1 << R"V0G0N(" to-port="0"/>)V0G0N";
+    }
+    std::string model = "<net name=\"Network\" version=\"10\">\n    <layers>" + layers.str() +
+                        "\n    </layers>\n    <edges>" + edges.str() + "\n    </edges>\n</net>\n";
+
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {constantsNum * sizeof(float)}, Layout::C));
+    weights->allocate();
+
+    try {
+        ie.ReadNetwork(model, weights);
+        FAIL() << "Reading of the network with broken constant must fail";
+    } catch (const std::exception& e) {
+        ASSERT_NE(std::string::npos, std::string(e.what()).find("Incorrect weights in bin file!"));
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph_ops/multi_head_attention.hpp>
+#include <transformations/common_optimizations/multi_head_attention_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+void runFusion(const std::shared_ptr<Function>& f) {
+    pass::Manager m;
+    m.register_pass<pass::InitNodeInfo>();
+    m.register_pass<pass::MultiHeadAttentionFusion>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+}
+}  // namespace
+
+TEST(TransformationTests, MultiHeadAttentionFusionWithScaleAndMask) {
+    const Shape qkv_shape{2, 12, 128, 64};
+    const Shape mask_shape{2, 1, 1, 128};
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, mask_shape);
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto scaled = std::make_shared<opset1::Divide>(qk, opset1::Constant::create(element::f32, Shape{}, {8.f}));
+        auto masked = std::make_shared<opset1::Add>(mask, scaled);
+        auto softmax = std::make_shared<opset1::Softmax>(masked, 3);
+        auto qkv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{qkv}, ParameterVector{q, k, v, mask});
+
+        runFusion(f);
+    }
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, mask_shape);
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, mask, 0.125f, false);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q, k, v, mask});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionTransposedKey) {
+    const Shape qv_shape{1, 4, 32, 16};
+    const Shape k_shape{1, 4, 16, 32};
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, k_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qv_shape);
+        auto qk = std::make_shared<opset1::MatMul>(q, k);
+        auto scaled = std::make_shared<opset1::Multiply>(qk, opset1::Constant::create(element::f32, Shape{1}, {0.25f}));
+        auto softmax = std::make_shared<opset1::Softmax>(scaled, 3);
+        auto qkv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{qkv}, ParameterVector{q, k, v});
+
+        runFusion(f);
+    }
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, k_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qv_shape);
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, 0.25f, true);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q, k, v});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionNegativeScoresConsumed) {
+    const Shape qkv_shape{1, 4, 32, 16};
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto qkv = std::make_shared<opset1::MatMul>(softmax, v);
+        // the attention scores are the output of the model, so they have to be computed anyway
+        f = std::make_shared<Function>(NodeVector{qkv, qk}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        runFusion(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionNegativeSoftmaxAxis) {
+    const Shape qkv_shape{1, 4, 32, 32};
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 2);
+        auto qkv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{qkv}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        runFusion(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionNegativeBroadcastedKey) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        // MatMul broadcasts the key over the batch, the fused operation doesn't
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 32, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 4, 32, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 4, 32, 16});
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto qkv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{qkv}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        runFusion(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionNegativeDynamicShape) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        const PartialShape qkv_shape{Dimension::dynamic(), 4, 32, 16};
+        auto q = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto k = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto v = std::make_shared<opset1::Parameter>(element::f32, qkv_shape);
+        auto qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(qk, 3);
+        auto qkv = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{qkv}, ParameterVector{q, k, v});
+        f_ref = clone_function(*f);
+
+        runFusion(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -50,4 +50,39 @@ INSTANTIATE_TEST_CASE_P(
         GatherLayerTest::getTestCaseName
 );
 
+// Gather-7 with batch_dims isn't converted to Gather-1, the CPU plugin takes the axis from the constant input
+const std::vector<std::vector<size_t>> inputShapes7 = {
+        std::vector<size_t>{2, 3, 4, 5},
+};
+
+const std::vector<std::vector<size_t>> indicesShapes7 = {
+        std::vector<size_t>{2, 3, 7},
+};
+
+const std::vector<std::tuple<int, int>> axesBatches7 = {
+        std::tuple<int, int>{3, 1},
+        std::tuple<int, int>{-1, 2},
+        std::tuple<int, int>{-2, 1},
+        std::tuple<int, int>{-1, -1},
+};
+
+const auto params7 = testing::Combine(
+        testing::ValuesIn(inputShapes7),
+        testing::ValuesIn(indicesShapes7),
+        testing::ValuesIn(axesBatches7),
+        testing::ValuesIn(netPrecisions),
+        testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        testing::Values(InferenceEngine::Layout::ANY),
+        testing::Values(InferenceEngine::Layout::ANY),
+        testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(
+        smoke_Gather7BatchDims,
+        Gather7LayerTest,
+        params7,
+        Gather7LayerTest::getTestCaseName
+);
+
 }  // namespace
@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+
+#include <ngraph_functions/builders.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+struct MultiHeadAttentionConfig {
+    size_t batch;
+    size_t heads;
+    size_t queryLength;
+    size_t keyLength;
+    size_t headSize;
+    size_t valueHeadSize;
+};
+
+typedef std::tuple<
+    MultiHeadAttentionConfig,           // attention dimensions
+    std::vector<size_t>,                // mask shape, empty if there is no mask
+    bool,                               // key is passed transposed to the MatMul
+    std::string                         // targetDevice
+> multiHeadAttentionCPUTestParams;
+
+/* The graph MatMul -> Multiply -> [Add mask] -> Softmax -> MatMul is fused into the MultiHeadAttention node by the plugin,
+ * its blockwise online softmax is compared with the reference of the original MatMul and Softmax operations.
+
+      Q   K
+       \ /
+      MatMul
+        |
+     Multiply (scale)
+        |
+       Add <--- mask (optional)
+        |
+     Softmax   V
+         \    /
+         MatMul
+*/
+class MultiHeadAttentionLayerCPUTest : public testing::WithParamInterface<multiHeadAttentionCPUTestParams>,
+                                       virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<multiHeadAttentionCPUTestParams>& obj) {
+        MultiHeadAttentionConfig config;
+        std::vector<size_t> maskShape;
+        bool kTransposed;
+        std::string targetDevice;
+        std::tie(config, maskShape, kTransposed, targetDevice) = obj.param;
+
+        std::ostringstream result;
+        result << "B=" << config.batch << "_H=" << config.heads << "_L=" << config.queryLength << "_Lk=" << config.keyLength
+               << "_S=" << config.headSize << "_Sv=" << config.valueHeadSize << "_";
+        result << "mask=" << (maskShape.empty() ? "none" : CommonTestUtils::vec2str(maskShape)) << "_";
+        result << "kTransposed=" << kTransposed << "_";
+        result << "trgDev=" << targetDevice;
+
+        return result.str();
+    }
+
+    // small values keep the exponents of the scores in a reasonable range
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 64);
+    }
+
+protected:
+    void SetUp() override {
+        MultiHeadAttentionConfig config;
+        std::vector<size_t> maskShape;
+        bool kTransposed;
+        std::tie(config, maskShape, kTransposed, targetDevice) = this->GetParam();
+
+        inPrc = outPrc = Precision::FP32;
+        selectedType = std::string("ref_") + inPrc.name();
+
+        const auto ngPrc = ngraph::element::f32;
+        const std::vector<size_t> queryShape{config.batch, config.heads, config.queryLength, config.headSize};
+        const std::vector<size_t> keyShape = kTransposed ? std::vector<size_t>{config.batch, config.heads, config.headSize, config.keyLength}
+                                                         : std::vector<size_t>{config.batch, config.heads, config.keyLength, config.headSize};
+        const std::vector<size_t> valueShape{config.batch, config.heads, config.keyLength, config.valueHeadSize};
+        std::vector<std::vector<size_t>> inputShapes{queryShape, keyShape, valueShape};
+        if (!maskShape.empty())
+            inputShapes.push_back(maskShape);
+        auto params = ngraph::builder::makeParams(ngPrc, inputShapes);
+
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(params[0], params[1], false, !kTransposed);
+        const float scale = 1.f / std::sqrt(static_cast<float>(config.headSize));
+        std::shared_ptr<ngraph::Node> scores = std::make_shared<ngraph::opset1::Multiply>(qk,
+            ngraph::opset1::Constant::create(ngPrc, ngraph::Shape{}, {scale}));
+        if (!maskShape.empty())
+            scores = std::make_shared<ngraph::opset1::Add>(scores, params[3]);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 3);
+        auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, params[2]);
+
+        function = makeNgraphFunction(ngPrc, params, attention, "MultiHeadAttention");
+    }
+};
+
+TEST_P(MultiHeadAttentionLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "MultiHeadAttention");
+}
+
+namespace {
+const std::vector<MultiHeadAttentionConfig> configs {
+        // a single block of queries and a single tile of keys
+        {1, 2, 8, 16, 8, 8},
+        // several query blocks and key tiles with partial tails
+        {2, 3, 40, 100, 16, 16},
+        {1, 4, 33, 65, 24, 12},
+        // the last key tile is a single column
+        {1, 1, 64, 129, 32, 32},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_MultiHeadAttention_CPU, MultiHeadAttentionLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(configs),
+                                ::testing::Values(std::vector<size_t>{}),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        MultiHeadAttentionLayerCPUTest::getTestCaseName);
+
+const std::vector<std::vector<size_t>> maskShapes {
+        // padding mask broadcasted over the heads and the queries
+        {2, 1, 1, 100},
+        // full mask per head
+        {2, 3, 40, 100},
+        // the mask of lower rank is broadcasted from the innermost dimensions
+        {40, 100},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_MultiHeadAttentionMask_CPU, MultiHeadAttentionLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(MultiHeadAttentionConfig{2, 3, 40, 100, 16, 16}),
+                                ::testing::ValuesIn(maskShapes),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        MultiHeadAttentionLayerCPUTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -182,6 +182,17 @@ INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16inPlace, SplitLayerCPUTest,
                                 ::testing::Values(blocked16_4D)),
                         SplitLayerCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16inPlaceSpatial, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(2),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(std::vector<size_t>({3, 16, 24, 9})),
+                                ::testing::ValuesIn(outIndices3),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(blocked16_4D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_CASE_P(smoke_Split4D_CPU_Block16, SplitLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(4),
@@ -226,6 +237,17 @@ INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16inPlace, SplitLayerCPUTest,
                                 ::testing::Values(blocked16_5D)),
                         SplitLayerCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16inPlaceSpatial, SplitLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3),
+                                ::testing::Values(3),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(std::vector<size_t>({3, 16, 1, 9, 15})),
+                                ::testing::ValuesIn(outIndices3),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::Values(blocked16_5D)),
+                        SplitLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_CASE_P(smoke_Split5D_CPU_Block16, SplitLayerCPUTest,
                         ::testing::Combine(
                                 ::testing::Values(4),
@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,                                             // Input shape
+        std::string                                        // Device name
+> BinarizationOddChannelsTuple;
+
+/* The binarized tensor packs the channels of each spatial point into whole bytes, so it takes more memory than
+ * one bit per element when the number of channels isn't a multiple of 8. It shares the workspace with the scaled
+ * input which is alive until the Add, an undersized binarized tensor overwrites it.
+
+        Param
+          |
+       Multiply
+        /    \
+   FakeQuantize |
+       |        |
+   BinaryConv   |
+        \      /
+          Add
+*/
+class BinarizationOddChannelsTest : public testing::WithParamInterface<BinarizationOddChannelsTuple>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BinarizationOddChannelsTuple> &obj) {
+        Shape inputShape;
+        std::string targetName;
+        std::tie(inputShape, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << inputShape << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 64);
+    }
+
+protected:
+    void SetUp() override {
+        Shape inputShape;
+        std::tie(inputShape, targetDevice) = this->GetParam();
+        const size_t channels = inputShape[1];
+
+        const auto param = std::make_shared<opset1::Parameter>(element::f32, inputShape);
+        const auto multiply = std::make_shared<opset1::Multiply>(param, opset1::Constant::create(element::f32, Shape{}, {2.f}));
+        // levels = 2 with the equal input bounds and the output bounds of 0 and 1 is executed as the binarization
+        const auto binarization = builder::makeFakeQuantize(multiply, element::f32, 2, {1, 1, 1, 1}, {0.f}, {0.f}, {0.f}, {1.f});
+        const auto binConv = builder::makeBinaryConvolution(binarization, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                            op::PadType::EXPLICIT, channels, 1.f);
+        const auto add = std::make_shared<opset1::Add>(binConv, multiply);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{param}, "BinarizationOddChannels");
+    }
+};
+
+TEST_P(BinarizationOddChannelsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+std::vector<Shape> inputShapes {
+    {1, 3, 10, 10}, {2, 12, 7, 9}, {1, 21, 16, 16}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_BinarizationOddChannels, BinarizationOddChannelsTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(inputShapes),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    BinarizationOddChannelsTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -16,6 +16,7 @@ class MockIInferRequestInternal : public InferenceEngine::IInferRequestInternal
 public:
     using InferenceEngine::IInferRequestInternal::IInferRequestInternal;
     MOCK_METHOD0(StartAsync, void());
+    MOCK_METHOD1(StartAsyncWithPriority, void(const InferenceEngine::TaskPriority&));
     MOCK_METHOD1(Wait, InferenceEngine::StatusCode(int64_t));
     MOCK_METHOD0(Infer, void());
     MOCK_CONST_METHOD0(GetPerformanceCounts, std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>());
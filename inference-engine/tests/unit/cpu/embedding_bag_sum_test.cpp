@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "nodes/embedding_bag_sum_imp.hpp"
+
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace {
+uint16_t toBf16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+float fromBf16(uint16_t value) {
+    const uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+void referenceBagSum(const std::vector<float>& table, size_t embDepth, const size_t* indices, size_t indicesNum,
+                     const float* weights, float* dst) {
+    std::fill(dst, dst + embDepth, 0.f);
+    for (size_t i = 0; i < indicesNum; i++) {
+        for (size_t d = 0; d < embDepth; d++)
+            dst[d] += table[indices[i] * embDepth + d] * (weights ? weights[i] : 1.f);
+    }
+}
+}  // namespace
+
+TEST(EmbeddingBagSumKernelTest, MatchesReference) {
+    const size_t rows = 50;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> valueDist(-1.f, 1.f);
+    std::uniform_int_distribution<size_t> indexDist(0, rows - 1);
+
+    for (size_t embDepth : {1, 5, 16, 64, 100}) {
+        // table values are representable in bf16, so the results match the fp32 reference
+        std::vector<float> table(rows * embDepth);
+        std::vector<uint16_t> bf16Data(table.size());
+        for (size_t i = 0; i < table.size(); i++) {
+            bf16Data[i] = toBf16(valueDist(gen));
+            table[i] = fromBf16(bf16Data[i]);
+        }
+
+        for (size_t indicesNum : {0, 1, 7, 33}) {
+            std::vector<size_t> indices(indicesNum);
+            std::vector<float> weights(indicesNum);
+            for (size_t i = 0; i < indicesNum; i++) {
+                indices[i] = indexDist(gen);
+                weights[i] = valueDist(gen);
+            }
+
+            for (bool bf16Table : {false, true}) {
+                for (bool withWeights : {false, true}) {
+                    const float* weightsPtr = withWeights ? weights.data() : nullptr;
+
+                    std::vector<float> expected(embDepth), actual(embDepth, 42.f);
+                    referenceBagSum(table, embDepth, indices.data(), indicesNum, weightsPtr, expected.data());
+                    XARCH::emb_bag_sum(bf16Table ? static_cast<const void*>(bf16Data.data()) : table.data(), bf16Table,
+                                       embDepth, indices.data(), indicesNum, weightsPtr, actual.data());
+                    for (size_t d = 0; d < embDepth; d++)
+                        ASSERT_NEAR(expected[d], actual[d], 1e-4f) << "depth: " << embDepth << ", bf16: " << bf16Table
+                            << ", weights: " << withWeights << ", indices: " << indicesNum << ", element: " << d;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <precision_utils.h>
+#include "nodes/fullyconnected_compressed_imp.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace {
+void referenceFC(const std::vector<float>& src, const std::vector<float>& weights, const std::vector<float>& scales,
+                 const std::vector<float>& bias, std::vector<float>& dst, size_t M, size_t N, size_t K) {
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double sum = 0.0;
+            for (size_t k = 0; k < K; k++)
+                sum += static_cast<double>(src[m * K + k]) * weights[n * K + k];
+            dst[m * N + n] = static_cast<float>(sum) * (scales.empty() ? 1.f : scales[n]) + (bias.empty() ? 0.f : bias[n]);
+        }
+    }
+}
+
+std::vector<float> makeFCData(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = dist(gen);
+    return data;
+}
+
+void checkFCCompressed(size_t M, size_t K, bool int8Weights, bool withBias, std::mt19937& gen) {
+    const size_t N = 19;
+    const auto src = makeFCData(M * K, gen);
+    const auto bias = withBias ? makeFCData(N, gen) : std::vector<float>();
+
+    // the reference gets the decompressed weights, so only the accumulation order differs
+    std::vector<float> weights(N * K), scales;
+    std::vector<ie_fp16> fp16Weights(N * K);
+    std::vector<int8_t> int8Data(N * K);
+    if (int8Weights) {
+        std::uniform_int_distribution<int> dist(-127, 127);
+        for (size_t i = 0; i < N * K; i++) {
+            int8Data[i] = static_cast<int8_t>(dist(gen));
+            weights[i] = int8Data[i];
+        }
+        scales = makeFCData(N, gen);
+    } else {
+        const auto values = makeFCData(N * K, gen);
+        PrecisionUtils::f32tof16Arrays(fp16Weights.data(), values.data(), values.size());
+        PrecisionUtils::f16tof32Arrays(weights.data(), fp16Weights.data(), weights.size());
+    }
+
+    std::vector<float> expected(M * N), actual(M * N, 42.f);
+    referenceFC(src, weights, scales, bias, expected, M, N, K);
+    const void* weightsPtr = int8Weights ? static_cast<const void*>(int8Data.data()) : fp16Weights.data();
+    // two calls check that the outputs split between the threads are computed independently
+    const size_t split = 5;
+    XARCH::fc_compressed(src.data(), weightsPtr, int8Weights, scales.empty() ? nullptr : scales.data(),
+                         bias.empty() ? nullptr : bias.data(), actual.data(), M, N, K, 0, split);
+    XARCH::fc_compressed(src.data(), weightsPtr, int8Weights, scales.empty() ? nullptr : scales.data(),
+                         bias.empty() ? nullptr : bias.data(), actual.data(), M, N, K, split, N);
+
+    const float tolerance = int8Weights ? 1e-4f * K * 127.f : 1e-4f * K;
+    for (size_t i = 0; i < M * N; i++)
+        ASSERT_NEAR(expected[i], actual[i], tolerance) << "row: " << i / N << ", output: " << i % N;
+}
+}  // namespace
+
+TEST(FCCompressedKernelTest, MatchesReference) {
+    std::mt19937 gen(42);
+    for (size_t M : {1, 3, 4, 9}) {
+        for (size_t K : {1, 7, 64, 100}) {
+            for (bool int8Weights : {false, true}) {
+                for (bool withBias : {false, true}) {
+                    SCOPED_TRACE("rows " + std::to_string(M) + ", inputs " + std::to_string(K) +
+                                 (int8Weights ? ", int8" : ", fp16") + (withBias ? ", bias" : ""));
+                    checkFCCompressed(M, K, int8Weights, withBias, gen);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "nodes/common/gather_kernel.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+void referenceGather(const std::vector<uint8_t>& src, const std::vector<int32_t>& indices, std::vector<uint8_t>& dst,
+                     size_t rowBytes, size_t range) {
+    for (size_t i = 0; i < indices.size(); i++) {
+        int64_t idx = indices[i];
+        if (idx < 0)
+            idx += range;
+        if (idx >= 0 && idx < static_cast<int64_t>(range)) {
+            std::memcpy(&dst[i * rowBytes], &src[idx * rowBytes], rowBytes);
+        } else {
+            std::memset(&dst[i * rowBytes], 0, rowBytes);
+        }
+    }
+}
+
+std::vector<uint8_t> makeGatherData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<uint8_t>(i % 251 + 1);
+    return data;
+}
+}  // namespace
+
+TEST(GatherKernelTest, MatchesReference) {
+    const size_t range = 37;
+
+    // in range, negative, out of range and a tail which is not a multiple of the vector length
+    std::vector<int32_t> indices;
+    for (int32_t i = -static_cast<int32_t>(range) - 3; i < static_cast<int32_t>(range) + 3; i++)
+        indices.push_back(i);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int32_t> dist(0, range - 1);
+    for (size_t i = 0; i < 61; i++)
+        indices.push_back(dist(gen));
+
+    for (size_t dataSize : {1, 2, 4}) {
+        for (size_t rowSize : {1, 3, 16, 64, 100, 1000}) {
+            const size_t rowBytes = dataSize * rowSize;
+            const auto src = makeGatherData(range * rowBytes);
+            std::vector<uint8_t> expected(indices.size() * rowBytes), actual(indices.size() * rowBytes, 0xff);
+            referenceGather(src, indices, expected, rowBytes, range);
+
+            GatherKernel kernel({dataSize, rowSize, range});
+            kernel.execute(src.data(), indices.data(), actual.data(), indices.size());
+            ASSERT_EQ(expected, actual) << "data size " << dataSize << ", row size " << rowSize;
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "utils/jit_kernel_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+struct TestKernel {
+    explicit TestKernel(int param) : param(param) {}
+    int param;
+};
+
+struct TestParams {
+    bool flag;
+    int value;
+    std::vector<size_t> offsets;
+};
+
+JitKernelKey makeKey(const TestParams& params) {
+    JitKernelKey key;
+    key << params.flag << params.value << params.offsets;
+    return key;
+}
+
+class JitKernelCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        JitKernelCache<TestKernel>::clear();
+    }
+    void TearDown() override {
+        JitKernelCache<TestKernel>::clear();
+    }
+};
+}  // namespace
+
+TEST_F(JitKernelCacheTest, SameParamsShareKernel) {
+    int builds = 0;
+    auto builder = [&]() {
+        builds++;
+        return std::make_shared<TestKernel>(builds);
+    };
+
+    auto first = JitKernelCache<TestKernel>::getOrCreate(makeKey({true, 3, {1, 2}}), builder);
+    auto second = JitKernelCache<TestKernel>::getOrCreate(makeKey({true, 3, {1, 2}}), builder);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(1, builds);
+
+    auto other = JitKernelCache<TestKernel>::getOrCreate(makeKey({true, 3, {1, 2, 0}}), builder);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(2, builds);
+    ASSERT_EQ(2u, JitKernelCache<TestKernel>::size());
+}
+
+TEST_F(JitKernelCacheTest, FailedBuildIsNotCached) {
+    auto key = makeKey({false, 1, {}});
+    ASSERT_THROW(JitKernelCache<TestKernel>::getOrCreate(key, []() -> std::shared_ptr<TestKernel> {
+        throw std::runtime_error("generation failed");
+    }), std::runtime_error);
+    ASSERT_EQ(0u, JitKernelCache<TestKernel>::size());
+
+    auto kernel = JitKernelCache<TestKernel>::getOrCreate(key, []() { return std::make_shared<TestKernel>(7); });
+    ASSERT_EQ(7, kernel->param);
+}
+
+TEST_F(JitKernelCacheTest, ConcurrentRequestsBuildOnce) {
+    std::atomic<int> builds(0);
+    auto builder = [&]() {
+        builds++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return std::make_shared<TestKernel>(0);
+    };
+
+    const size_t threadsNum = 8;
+    std::vector<std::shared_ptr<TestKernel>> kernels(threadsNum);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsNum; i++) {
+        threads.emplace_back([&, i]() {
+            kernels[i] = JitKernelCache<TestKernel>::getOrCreate(makeKey({true, 42, {}}), builder);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(1, builds);
+    for (auto& kernel : kernels)
+        ASSERT_EQ(kernels[0], kernel);
+}
+
+TEST_F(JitKernelCacheTest, OldestKernelsAreEvicted) {
+    auto builder = []() { return std::make_shared<TestKernel>(0); };
+    auto firstKey = makeKey({false, -1, {}});
+    auto first = JitKernelCache<TestKernel>::getOrCreate(firstKey, builder);
+    for (int i = 0; i < static_cast<int>(JitKernelCache<TestKernel>::capacity); i++)
+        JitKernelCache<TestKernel>::getOrCreate(makeKey({false, i, {}}), builder);
+    ASSERT_EQ(JitKernelCache<TestKernel>::capacity, JitKernelCache<TestKernel>::size());
+
+    // the evicted kernel stays valid for its users and is generated anew for the next ones
+    ASSERT_EQ(0, first->param);
+    ASSERT_NE(first, JitKernelCache<TestKernel>::getOrCreate(firstKey, builder));
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "config.h"
+#include "mkldnn_plugin.h"
+#include "mkldnn_exec_network.h"
+#include "mkldnn_infer_request.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+CNNNetwork deferredConstantsNetwork() {
+    const size_t channels = 16;
+    std::vector<float> weightsData(channels * channels * 3 * 3);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, 8, 8});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{channels, channels, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                              ngraph::Strides{1, 1});
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, channels, 1, 1}, std::vector<float>(channels, 0.5f));
+    auto mul = std::make_shared<ngraph::opset1::Multiply>(conv, scale);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{param});
+    return CNNNetwork(function);
+}
+
+// The constant addend has the batch dimension, so it is reordered by a constant node which is sensitive to the dynamic batch
+CNNNetwork batchedConstantNetwork() {
+    const size_t batch = 2, channels = 16;
+    std::vector<float> addendData(batch * channels * 8 * 8);
+    for (size_t i = 0; i < addendData.size(); i++)
+        addendData[i] = static_cast<float>(i % 13) * 0.5f;
+
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, channels, 8, 8});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{channels, channels, 1, 1},
+                                                    std::vector<float>(channels * channels, 0.25f));
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                              ngraph::Strides{1, 1});
+    auto addend = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{batch, channels, 8, 8}, addendData);
+    auto add = std::make_shared<ngraph::opset1::Add>(conv, addend);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{param});
+    return CNNNetwork(function);
+}
+
+// Infers the given number of times, then once with each of the dynamic batches, and returns the last output
+std::vector<float> inferDeferred(const std::map<std::string, std::string>& config, int iterations,
+                                 CNNNetwork network = deferredConstantsNetwork(), const std::vector<int>& batches = {}) {
+    Engine engine;
+    auto execNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(engine.LoadExeNetworkImpl(network, config));
+    EXPECT_NE(nullptr, execNetwork);
+    auto request = std::dynamic_pointer_cast<MKLDNNInferRequest>(
+        execNetwork->CreateInferRequestImpl(network.getInputsInfo(), network.getOutputsInfo()));
+    EXPECT_NE(nullptr, request);
+
+    auto input = request->GetBlob(network.getInputsInfo().begin()->first);
+    auto inputData = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        inputData[i] = static_cast<float>(i % 11) * 0.125f;
+
+    for (int i = 0; i < iterations; i++)
+        request->InferImpl();
+
+    for (auto batch : batches) {
+        request->SetBatch(batch);
+        request->InferImpl();
+    }
+
+    auto output = request->GetBlob(network.getOutputsInfo().begin()->first);
+    auto outputData = output->cbuffer().as<const float*>();
+    return std::vector<float>(outputData, outputData + output->size());
+}
+
+const std::vector<std::string> deferredConstantsModes = {PluginConfigParams::CPU_CONSTANTS_BACKGROUND,
+                                                          PluginConfigParams::CPU_CONSTANTS_ON_FIRST_INFER};
+}  // namespace
+
+TEST(DeferredConstantsTest, FirstInferenceMatchesEagerPreparation) {
+    auto expected = inferDeferred({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::NO}}, 1);
+    for (const auto& mode : deferredConstantsModes) {
+        auto actual = inferDeferred({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, mode}}, 1);
+        ASSERT_EQ(expected, actual) << mode;
+    }
+}
+
+TEST(DeferredConstantsTest, SeveralStreamsMatchEagerPreparation) {
+    auto expected = inferDeferred({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::NO}}, 1);
+    for (const auto& mode : deferredConstantsModes) {
+        auto actual = inferDeferred({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, mode},
+                                     {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}, 3);
+        ASSERT_EQ(expected, actual) << mode;
+    }
+}
+
+TEST(DeferredConstantsTest, DynamicBatchDoesNotTruncateConstants) {
+    auto expected = inferDeferred({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::NO},
+                                   {PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}}, 0,
+                                  batchedConstantNetwork(), {2});
+    for (const auto& mode : deferredConstantsModes) {
+        // the constants are prepared by the inference with the smaller batch, then used with the whole one
+        auto actual = inferDeferred({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, mode},
+                                     {PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}}, 0,
+                                    batchedConstantNetwork(), {1, 2});
+        ASSERT_EQ(expected, actual) << mode;
+    }
+}
+
+TEST(DeferredConstantsConfigTest, WrongValueIsRejected) {
+    Config config;
+    EXPECT_THROW(config.readProperties({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, "SOMETIMES"}}), InferenceEngine::Exception);
+    config.readProperties({{PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS, PluginConfigParams::CPU_CONSTANTS_BACKGROUND}});
+    EXPECT_EQ(Config::DeferredConstants::Background, config.deferredConstants);
+    EXPECT_EQ(PluginConfigParams::CPU_CONSTANTS_BACKGROUND, config._config[PluginConfigParams::KEY_CPU_DEFERRED_CONSTANTS]);
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+
+#include "utils/huge_pages.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(HugePagesTest, SmallBuffersFallBackToRegularAllocation) {
+    EXPECT_EQ(nullptr, allocateHugePages(hugePageSize - 1));
+}
+
+TEST(HugePagesTest, BufferIsZeroedAndWritable) {
+    const size_t size = 3 * hugePageSize + 100;
+    auto buffer = allocateHugePages(size, getAvailableNUMANodes().front());
+    if (!buffer)
+        GTEST_SKIP() << "Huge pages are not supported by the system";
+
+    auto data = static_cast<char*>(buffer.get());
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data) % hugePageSize);
+    for (size_t i = 0; i < size; i += 4096) {
+        ASSERT_EQ(0, data[i]);
+        data[i] = 1;
+    }
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <random>
+#include <string>
 #include <vector>
 #include <gtest/gtest.h>
 #include <ie_common.h>
@@ -114,7 +116,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{    //  |            __________
             {6, 7, 3},         //  |   ____    |_3________|
             {2, 5, 2},         //  |  |_4__|_____ |    |
@@ -123,9 +125,13 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
+
+    // box 2 lifted over box 4 takes the place box 1 needs
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::FirstFit), 6);
+    EXPECT_EQ(ms.solve(MKLDNNPlugin::MemorySolver::Strategy::BestFit), 5);
 }
 
 TEST(MemSolverTest, OverlappingBoxes) {
@@ -233,9 +239,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -273,3 +277,184 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, GapReleasesMemory) {
+    using Gap = MKLDNNPlugin::MemorySolver::Gap;
+    int n = 0;                //  |       ____ ____
+    std::vector<Box> boxes{   //  |      |    |    |
+            {0, 3, 2, n++},   //  |      |_1__|_2__|
+            {1, 1, 8, n++},   //  |  _0__|    |    |_0+3_
+            {2, 2, 8, n++},   //  |_|____|____|____|_____|__
+            {3, 3, 2, n++},   //      0    1    2    3
+    };
+
+    MKLDNNPlugin::MemorySolver withoutGap(boxes);
+    EXPECT_EQ(withoutGap.maxDepth(), 10);
+    EXPECT_EQ(withoutGap.solve(), 10);
+
+    // box 0 is not needed at 1 and 2, so it can share the memory with the big ones
+    MKLDNNPlugin::MemorySolver ms(boxes, {Gap{0, 1, 2}});
+    EXPECT_EQ(ms.maxDepth(), 8);
+    EXPECT_EQ(ms.solve(), 8);
+}
+
+TEST(MemSolverTest, GapInsideOfSingleTimeSlotIsIgnored) {
+    using Gap = MKLDNNPlugin::MemorySolver::Gap;
+    std::vector<Box> boxes{
+            {0, 6, 2, 0},
+            {2, 5, 2, 1},
+    };
+
+    // there is no box start between 3 and 4, so the data has to be kept at timestamp 3 anyway
+    MKLDNNPlugin::MemorySolver ms(boxes, {Gap{0, 3, 3}});
+    EXPECT_EQ(ms.maxDepth(), 4);
+    EXPECT_EQ(ms.solve(), 4);
+}
+
+TEST(MemSolverTest, InvalidGapThrowException) {
+    using Gap = MKLDNNPlugin::MemorySolver::Gap;
+    std::vector<Box> boxes{
+            {0, 4, 2, 0},
+            {1, 2, 2, 1},
+    };
+
+    EXPECT_THROW(MKLDNNPlugin::MemorySolver(boxes, {Gap{0, 0, 2}}), InferenceEngine::Exception);
+    EXPECT_THROW(MKLDNNPlugin::MemorySolver(boxes, {Gap{0, 1, 4}}), InferenceEngine::Exception);
+    EXPECT_THROW(MKLDNNPlugin::MemorySolver(boxes, {Gap{5, 1, 2}}), InferenceEngine::Exception);
+    EXPECT_THROW(MKLDNNPlugin::MemorySolver(boxes, {Gap{0, 1, 1}, Gap{0, 2, 2}}), InferenceEngine::Exception);
+}
+
+namespace {
+using Strategy = MKLDNNPlugin::MemorySolver::Strategy;
+
+void checkNoOverlapping(const std::vector<Box>& boxes, MKLDNNPlugin::MemorySolver& ms) {
+    for (size_t i = 0; i < boxes.size(); i++) {
+        for (size_t j = i + 1; j < boxes.size(); j++) {
+            const Box &l = boxes[i], &r = boxes[j];
+            const int64_t l_off = ms.getOffset(l.id), r_off = ms.getOffset(r.id);
+            ASSERT_TRUE(l.finish < r.start || l.start > r.finish ||
+                        l_off + l.size <= r_off || l_off >= r_off + r.size)
+                << "Box overlapping is detected: " << l.id << " and " << r.id;
+        }
+    }
+}
+
+// Tensors of a plain chain of layers with some skip connections, sizes have the same order of magnitude
+std::vector<Box> makeResNetLike(std::mt19937& gen, int blocks) {
+    std::vector<Box> boxes;
+    std::uniform_int_distribution<int64_t> size(64, 256);
+    int t = 0;
+    for (int b = 0; b < blocks; b++) {
+        const int64_t block_size = size(gen) * 1024;
+        const int block_start = t;
+        for (int l = 0; l < 3; l++, t++)
+            boxes.push_back({t, t + 1, l == 1 ? block_size / 4 : block_size, static_cast<int64_t>(boxes.size())});
+        // shortcut lives until the sum at the end of the block
+        boxes.push_back({block_start, t, block_size, static_cast<int64_t>(boxes.size())});
+    }
+    return boxes;
+}
+
+// Encoder tensors are alive until the decoder stage of the same resolution
+std::vector<Box> makeUNetLike(int levels) {
+    std::vector<Box> boxes;
+    const int last = 4 * levels + 1;
+    for (int l = 0; l < levels; l++) {
+        const int64_t size = (int64_t(1) << (2 * (levels - l))) * 1024;
+        const int enc = 2 * l, dec = last - 2 * l;
+        boxes.push_back({enc, enc + 1, size, static_cast<int64_t>(boxes.size())});
+        boxes.push_back({enc + 1, dec, size, static_cast<int64_t>(boxes.size())});
+        boxes.push_back({dec - 1, dec, size, static_cast<int64_t>(boxes.size())});
+    }
+    return boxes;
+}
+
+// Parallel branches of different lengths and sizes joined by a concat
+std::vector<Box> makeInceptionLike(std::mt19937& gen, int modules) {
+    std::vector<Box> boxes;
+    std::uniform_int_distribution<int64_t> size(16, 128);
+    std::uniform_int_distribution<int> length(1, 4);
+    int t = 0;
+    for (int m = 0; m < modules; m++) {
+        const int input = t;
+        int join = t + 1;
+        std::vector<std::pair<int, int64_t>> branches;
+        for (int b = 0; b < 4; b++) {
+            int bt = input;
+            const int64_t branch_size = size(gen) * 1024;
+            for (int l = length(gen); l > 0; l--, bt++)
+                boxes.push_back({bt, bt + 1, branch_size, static_cast<int64_t>(boxes.size())});
+            branches.emplace_back(bt, branch_size);
+            join = std::max(join, bt + 1);
+        }
+        int64_t concat_size = 0;
+        for (const auto& branch : branches) {
+            boxes.push_back({branch.first, join, branch.second, static_cast<int64_t>(boxes.size())});
+            concat_size += branch.second;
+        }
+        boxes.push_back({join, join + 1, concat_size, static_cast<int64_t>(boxes.size())});
+        t = join + 1;
+    }
+    return boxes;
+}
+
+std::vector<std::pair<std::string, std::vector<Box>>> makeTopologies() {
+    std::mt19937 gen(42);
+    return {
+            {"resnet-like", makeResNetLike(gen, 16)},
+            {"unet-like", makeUNetLike(5)},
+            {"inception-like", makeInceptionLike(gen, 9)},
+    };
+}
+}  // namespace
+
+TEST(MemSolverTest, BestFitHasNoOverlapping) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> time(0, 30);
+    std::uniform_int_distribution<int64_t> size(1, 16);
+    for (int iter = 0; iter < 200; iter++) {
+        std::vector<Box> boxes(40);
+        for (size_t i = 0; i < boxes.size(); i++) {
+            int start = time(gen), finish = time(gen);
+            boxes[i] = {std::min(start, finish), std::max(start, finish), size(gen), static_cast<int64_t>(i)};
+        }
+        MKLDNNPlugin::MemorySolver first_fit(boxes), best_fit(boxes), minimal(boxes);
+        const int64_t first_fit_size = first_fit.solve(Strategy::FirstFit);
+        const int64_t best_fit_size = best_fit.solve(Strategy::BestFit);
+        EXPECT_GE(best_fit_size, best_fit.maxDepth());
+        EXPECT_EQ(minimal.solve(), std::min(first_fit_size, best_fit_size));
+        checkNoOverlapping(boxes, first_fit);
+        checkNoOverlapping(boxes, best_fit);
+        checkNoOverlapping(boxes, minimal);
+    }
+}
+
+TEST(MemSolverTest, BestFitHonoursGaps) {
+    using Gap = MKLDNNPlugin::MemorySolver::Gap;
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 3, 2, n++},
+            {1, 1, 8, n++},
+            {2, 2, 8, n++},
+            {3, 3, 2, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, {Gap{0, 1, 2}});
+    EXPECT_EQ(ms.solve(Strategy::BestFit), 8);
+}
+
+TEST(MemSolverTest, DefaultStrategyPicksSmallerArena) {
+    for (const auto& topology : makeTopologies()) {
+        const auto& boxes = topology.second;
+        int64_t sizes[2];
+        const Strategy strategies[2] = {Strategy::FirstFit, Strategy::BestFit};
+        for (int s = 0; s < 2; s++) {
+            MKLDNNPlugin::MemorySolver ms(boxes);
+            sizes[s] = ms.solve(strategies[s]);
+            checkNoOverlapping(boxes, ms);
+        }
+        MKLDNNPlugin::MemorySolver ms(boxes);
+        EXPECT_EQ(ms.solve(), std::min(sizes[0], sizes[1])) << topology.first;
+        EXPECT_GE(std::min(sizes[0], sizes[1]), ms.maxDepth()) << topology.first;
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+#include "utils/numa_memory.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+
+TEST(NumaMemoryTest, FirstTouchZeroesWholeBuffer) {
+    std::vector<uint8_t> buffer(3 * 4096 + 17, 0xAB);
+    firstTouch(buffer.data(), buffer.size());
+    ASSERT_TRUE(std::all_of(buffer.begin(), buffer.end(), [](uint8_t v) { return v == 0; }));
+}
+
+TEST(NumaMemoryTest, PlacementAccountsEveryByte) {
+    std::vector<uint8_t> buffer(5 * 4096 + 123, 1);
+    std::map<int, size_t> placement;
+    getNumaPlacement(buffer.data() + 7, buffer.size() - 7, placement);
+
+    size_t total = 0;
+    for (auto& node : placement)
+        total += node.second;
+    ASSERT_EQ(buffer.size() - 7, total);
+}
+
+TEST(NumaMemoryTest, BindIsNoopWithoutPreference) {
+    std::vector<uint8_t> buffer(4 * 4096, 1);
+    ASSERT_FALSE(bindToNumaNode(buffer.data(), buffer.size(), -1));
+    if (InferenceEngine::getAvailableNUMANodes().size() < 2)
+        ASSERT_FALSE(bindToNumaNode(buffer.data(), buffer.size(), 0));
+    // the content must stay untouched regardless of the binding result
+    ASSERT_TRUE(std::all_of(buffer.begin(), buffer.end(), [](uint8_t v) { return v == 1; }));
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "mkldnn_streams_auto_tuner.h"
+#include "mkldnn_plugin.h"
+#include "mkldnn_exec_network.h"
+#include "mkldnn_infer_request.h"
+
+#include <set>
+#include <tuple>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+IStreamsExecutor::Config makeDefaultConfig(int streams, int threadsPerStream) {
+    IStreamsExecutor::Config config;
+    config._streams = streams;
+    config._threadsPerStream = threadsPerStream;
+    config._threadBindingType = IStreamsExecutor::ThreadBindingType::CORES;
+    return config;
+}
+
+void checkCandidatesAreUnique(const std::vector<IStreamsExecutor::Config>& candidates) {
+    std::set<std::tuple<int, int, int>> unique;
+    for (auto&& candidate : candidates)
+        unique.emplace(candidate._streams, candidate._threadsPerStream, static_cast<int>(candidate._threadBindingType));
+    ASSERT_EQ(candidates.size(), unique.size());
+}
+}  // namespace
+
+TEST(StreamsAutoTunerTest, ThroughputCandidatesShareTheSameThreads) {
+    auto candidates = makeAutoTuneCandidates(makeDefaultConfig(1, 16), Config::AutoTuneMode::Throughput, 2, 32);
+    ASSERT_FALSE(candidates.empty());
+    checkCandidatesAreUnique(candidates);
+
+    // the default configuration goes first to win the ties
+    ASSERT_EQ(1, candidates.front()._streams);
+    ASSERT_EQ(16, candidates.front()._threadsPerStream);
+    ASSERT_EQ(IStreamsExecutor::ThreadBindingType::CORES, candidates.front()._threadBindingType);
+
+    std::set<int> streams;
+    for (auto&& candidate : candidates) {
+        ASSERT_EQ(16, candidate._streams * candidate._threadsPerStream);
+        ASSERT_EQ(candidate._threads, candidate._streams * candidate._threadsPerStream);
+        streams.insert(candidate._streams);
+    }
+    ASSERT_EQ((std::set<int>{1, 2, 4, 8, 16}), streams);
+    ASSERT_EQ(IStreamsExecutor::ThreadBindingType::NONE, candidates.back()._threadBindingType);
+}
+
+TEST(StreamsAutoTunerTest, LatencyCandidatesUseSingleStream) {
+    auto candidates = makeAutoTuneCandidates(makeDefaultConfig(1, 8), Config::AutoTuneMode::Latency, 1, 16);
+    checkCandidatesAreUnique(candidates);
+    std::set<int> threads;
+    for (auto&& candidate : candidates) {
+        ASSERT_EQ(1, candidate._streams);
+        threads.insert(candidate._threadsPerStream);
+    }
+    ASSERT_EQ((std::set<int>{4, 8, 16}), threads);
+}
+
+TEST(StreamsAutoTunerTest, SingleCoreHasNoDuplicates) {
+    for (auto mode : {Config::AutoTuneMode::Throughput, Config::AutoTuneMode::Latency}) {
+        auto candidates = makeAutoTuneCandidates(makeDefaultConfig(1, 1), mode, 1, 1);
+        checkCandidatesAreUnique(candidates);
+        // the default binding and no binding
+        ASSERT_EQ(2u, candidates.size());
+    }
+}
+
+// The candidates are run before any input is set, the indices must not be taken from uninitialized memory
+TEST(StreamsAutoTunerTest, IndicesInputIsInitializedForTuning) {
+    const size_t rows = 4, columns = 8;
+    std::vector<float> tableData(rows * columns);
+    for (size_t i = 0; i < tableData.size(); i++)
+        tableData[i] = static_cast<float>(i);
+    auto table = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{rows, columns}, tableData);
+    auto indices = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, ngraph::Shape{16});
+    auto axis = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, {0});
+    auto gather = std::make_shared<ngraph::opset1::Gather>(table, indices, axis);
+    CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::NodeVector{gather}, ngraph::ParameterVector{indices}));
+
+    Engine engine;
+    auto execNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(engine.LoadExeNetworkImpl(network,
+        {{PluginConfigParams::KEY_CPU_THROUGHPUT_AUTO_TUNE, PluginConfigParams::CPU_AUTO_TUNE_THROUGHPUT},
+         {PluginConfigParams::KEY_CPU_AUTO_TUNE_TIME_BUDGET_MS, "100"}}));
+    ASSERT_NE(nullptr, execNetwork);
+    auto request = std::dynamic_pointer_cast<MKLDNNInferRequest>(
+        execNetwork->CreateInferRequestImpl(network.getInputsInfo(), network.getOutputsInfo()));
+    ASSERT_NE(nullptr, request);
+
+    auto input = request->GetBlob(network.getInputsInfo().begin()->first);
+    auto inputData = input->buffer().as<int32_t*>();
+    for (size_t i = 0; i < input->size(); i++)
+        inputData[i] = static_cast<int32_t>((i * 3) % rows);
+    request->InferImpl();
+
+    auto output = request->GetBlob(network.getOutputsInfo().begin()->first);
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < input->size(); i++) {
+        for (size_t j = 0; j < columns; j++)
+            ASSERT_EQ(tableData[inputData[i] * columns + j], outputData[i * columns + j]);
+    }
+}
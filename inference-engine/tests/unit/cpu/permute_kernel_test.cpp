@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <debug.h>
+#include "nodes/common/permute_kernel.h"
+
+using namespace MKLDNNPlugin;
+using InferenceEngine::SizeVector;
+
+namespace {
+SizeVector permutedDims(const SizeVector& dims, const SizeVector& order) {
+    SizeVector result(dims.size());
+    for (size_t i = 0; i < dims.size(); i++)
+        result[i] = dims[order[i]];
+    return result;
+}
+
+// Element by element permutation of the plain tensor
+template <typename T>
+void referencePermute(const std::vector<T>& src, std::vector<T>& dst, const SizeVector& dims, const SizeVector& order) {
+    const size_t ndims = dims.size();
+    const SizeVector dstDims = permutedDims(dims, order);
+    SizeVector srcStrides(ndims, 1);
+    for (int i = static_cast<int>(ndims) - 2; i >= 0; i--)
+        srcStrides[i] = srcStrides[i + 1] * dims[i + 1];
+
+    SizeVector indexes(ndims, 0);
+    for (size_t i = 0; i < dst.size(); i++) {
+        size_t srcIdx = 0;
+        for (size_t j = 0; j < ndims; j++)
+            srcIdx += indexes[j] * srcStrides[order[j]];
+        dst[i] = src[srcIdx];
+        for (int j = static_cast<int>(ndims) - 1; j >= 0; j--) {
+            if (++indexes[j] < dstDims[j])
+                break;
+            indexes[j] = 0;
+        }
+    }
+}
+
+PermuteParams makePlainPermuteParams(const SizeVector& dims, const SizeVector& order, size_t dataSize) {
+    PermuteParams params;
+    params.data_size = dataSize;
+    params.order = order;
+    params.src_block_dims = dims;
+    params.dst_block_dims = permutedDims(dims, order);
+    params.src_block_order.resize(dims.size());
+    std::iota(params.src_block_order.begin(), params.src_block_order.end(), 0);
+    params.dst_block_order = params.src_block_order;
+    return params;
+}
+
+template <typename T>
+void checkPlainPermute(const SizeVector& dims, const SizeVector& order) {
+    const size_t size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+    std::vector<T> src(size), expected(size), actual(size);
+    for (size_t i = 0; i < size; i++)
+        src[i] = static_cast<T>(i % 251);
+    referencePermute(src, expected, dims, order);
+
+    PermuteKernel kernel(makePlainPermuteParams(dims, order, sizeof(T)));
+    kernel.execute(reinterpret_cast<const uint8_t*>(src.data()), reinterpret_cast<uint8_t*>(actual.data()), dims[0]);
+    ASSERT_EQ(expected, actual) << "dims " << InferenceEngine::details::dumpVec(dims) << ", order "
+                                << InferenceEngine::details::dumpVec(order) << ", data size " << sizeof(T);
+}
+}  // namespace
+
+TEST(PermuteKernelTest, MatchesReference) {
+    const std::pair<SizeVector, SizeVector> cases[] {
+        {{2, 12, 33, 64}, {0, 2, 1, 3}},
+        {{2, 12, 33, 64}, {0, 1, 3, 2}},
+        {{2, 16, 9, 10}, {0, 2, 3, 1}},
+        {{2, 16, 9, 10}, {0, 3, 1, 2}},
+        {{4, 5, 6}, {2, 0, 1}},
+        {{3, 5, 7}, {0, 2, 1}},
+        {{17, 1, 70}, {1, 0, 2}},
+        {{2, 3, 4, 5, 6}, {0, 4, 1, 2, 3}},
+        {{2, 3, 4, 5, 6}, {0, 2, 4, 3, 1}},
+        {{1, 2, 2, 3, 5, 7}, {0, 1, 4, 2, 5, 3}}
+    };
+
+    for (const auto& c : cases) {
+        checkPlainPermute<float>(c.first, c.second);
+        checkPlainPermute<int16_t>(c.first, c.second);
+        checkPlainPermute<uint8_t>(c.first, c.second);
+    }
+}
+
+TEST(PermuteKernelTest, BlockedToPlain) {
+    // nChw8c -> nchw, the channel blocks are unfolded by the transposes of 8 x W matrices
+    const size_t N = 2, C = 16, H = 5, W = 7, block = 8;
+    std::vector<float> src(N * C * H * W), expected(src.size()), actual(src.size());
+    std::iota(src.begin(), src.end(), 0.f);
+    for (size_t n = 0; n < N; n++)
+        for (size_t c = 0; c < C; c++)
+            for (size_t h = 0; h < H; h++)
+                for (size_t w = 0; w < W; w++)
+                    expected[((n * C + c) * H + h) * W + w] = src[(((n * C / block + c / block) * H + h) * W + w) * block + c % block];
+
+    PermuteParams params;
+    params.data_size = sizeof(float);
+    params.order = {0, 1, 2, 3};
+    params.src_block_dims = {N, C / block, H, W, block};
+    params.src_block_order = {0, 1, 2, 3, 1};
+    params.dst_block_dims = {N, C, H, W};
+    params.dst_block_order = {0, 1, 2, 3};
+    PermuteKernel kernel(params);
+    kernel.execute(reinterpret_cast<const uint8_t*>(src.data()), reinterpret_cast<uint8_t*>(actual.data()), N);
+    ASSERT_EQ(expected, actual);
+}
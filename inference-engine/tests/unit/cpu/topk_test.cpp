@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ie_blob.h>
+#include <legacy/ie_layers.h>
+#include "mkldnn_extension_mngr.h"
+#include "nodes/list.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+struct TopKLayer {
+    CNNLayerPtr layer;
+    DataPtr data, k, values, indices;
+};
+
+TopKLayer makeTopKLayer(const SizeVector& dims, int axis, size_t k, bool modeMax, bool sortValue) {
+    TopKLayer topk;
+    SizeVector outDims = dims;
+    outDims[axis] = k;
+    const auto layout = TensorDesc::getLayoutByDims(dims);
+
+    topk.layer = std::make_shared<CNNLayer>(LayerParams{"topk", "TopK", Precision::FP32});
+    topk.data = std::make_shared<Data>("data", TensorDesc(Precision::FP32, dims, layout));
+    topk.k = std::make_shared<Data>("k", TensorDesc(Precision::I32, {1}, Layout::C));
+    topk.values = std::make_shared<Data>("values", TensorDesc(Precision::FP32, outDims, layout));
+    topk.indices = std::make_shared<Data>("indices", TensorDesc(Precision::I32, outDims, layout));
+    topk.layer->insData = {topk.data, topk.k};
+    topk.layer->outData = {topk.values, topk.indices};
+    topk.layer->params = {{"axis", std::to_string(axis)},
+                          {"mode", modeMax ? "max" : "min"},
+                          {"sort", sortValue ? "value" : "index"}};
+    return topk;
+}
+
+ILayerExecImpl::Ptr createTopKImpl(const TopKLayer& topk) {
+    MKLDNNExtensionManager extensionManager;
+    extensionManager.AddExtension(std::make_shared<Extensions::Cpu::MKLDNNExtensions>());
+    auto factory = extensionManager.CreateExtensionFactory(topk.layer);
+    if (!factory)
+        return nullptr;
+
+    std::vector<ILayerImpl::Ptr> impls;
+    ResponseDesc resp;
+    if (factory->getImplementations(impls, &resp) != OK || impls.empty())
+        return nullptr;
+    return std::dynamic_pointer_cast<ILayerExecImpl>(impls[0]);
+}
+
+// equal values are ordered by their indices, NaN is the largest value
+void referenceTopK(const std::vector<float>& src, const SizeVector& dims, int axis, size_t k, bool modeMax,
+                   bool sortValue, std::vector<float>& values, std::vector<int>& indices) {
+    const size_t before = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t after = std::accumulate(dims.begin() + axis + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t n = dims[axis];
+    values.resize(before * k * after);
+    indices.resize(before * k * after);
+
+    std::vector<int> order(n);
+    for (size_t i0 = 0; i0 < before; i0++) {
+        for (size_t i1 = 0; i1 < after; i1++) {
+            auto value = [&](int i) { return src[(i0 * n + i) * after + i1]; };
+            std::iota(order.begin(), order.end(), 0);
+            std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](int a, int b) {
+                const bool nanA = std::isnan(value(a)), nanB = std::isnan(value(b));
+                if (nanA != nanB)
+                    return modeMax ? nanA : nanB;
+                if (!nanA && value(a) != value(b))
+                    return modeMax ? value(a) > value(b) : value(a) < value(b);
+                return a < b;
+            });
+            if (!sortValue)
+                std::sort(order.begin(), order.begin() + k);
+            for (size_t i2 = 0; i2 < k; i2++) {
+                values[(i0 * k + i2) * after + i1] = value(order[i2]);
+                indices[(i0 * k + i2) * after + i1] = order[i2];
+            }
+        }
+    }
+}
+
+// values are drawn from a small range, so there are many equal ones
+std::vector<float> makeTopKData(size_t size, std::mt19937& gen) {
+    std::uniform_int_distribution<int> dist(-500, 500);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = static_cast<float>(dist(gen));
+    return data;
+}
+
+// NaN values are expected at the same positions, the other values and all the indices exactly
+void checkTopK(std::vector<float>& src, const SizeVector& dims, size_t k, bool modeMax, bool sortValue) {
+    const auto topk = makeTopKLayer(dims, 1, k, modeMax, sortValue);
+    const auto impl = createTopKImpl(topk);
+    ASSERT_NE(nullptr, impl);
+
+    auto kBlob = make_shared_blob<int>(topk.k->getTensorDesc());
+    kBlob->allocate();
+    kBlob->buffer().as<int*>()[0] = static_cast<int>(k);
+    auto valuesBlob = make_shared_blob<float>(topk.values->getTensorDesc());
+    valuesBlob->allocate();
+    auto indicesBlob = make_shared_blob<int>(topk.indices->getTensorDesc());
+    indicesBlob->allocate();
+    std::vector<Blob::Ptr> inputs{make_shared_blob<float>(topk.data->getTensorDesc(), src.data()), kBlob};
+    std::vector<Blob::Ptr> outputs{valuesBlob, indicesBlob};
+    ResponseDesc resp;
+    ASSERT_EQ(OK, impl->execute(inputs, outputs, &resp)) << resp.msg;
+
+    std::vector<float> expectedValues;
+    std::vector<int> expectedIndices;
+    referenceTopK(src, dims, 1, k, modeMax, sortValue, expectedValues, expectedIndices);
+    const float* values = valuesBlob->cbuffer().as<const float*>();
+    const int* indices = indicesBlob->cbuffer().as<const int*>();
+    for (size_t i = 0; i < expectedValues.size(); i++) {
+        ASSERT_EQ(expectedIndices[i], indices[i]) << "element: " << i;
+        if (std::isnan(expectedValues[i]))
+            ASSERT_TRUE(std::isnan(values[i])) << "element: " << i;
+        else
+            ASSERT_EQ(expectedValues[i], values[i]) << "element: " << i;
+    }
+}
+}  // namespace
+
+TEST(TopKTest, MatchesReference) {
+    std::mt19937 gen(42);
+    // small k stays on the insertion path, large k and a single long row go to the selection
+    for (const auto& dims : {SizeVector{3, 1000}, SizeVector{3, 1000, 5}, SizeVector{1, 70000}}) {
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        auto src = makeTopKData(size, gen);
+        for (size_t k : {1, 10, 100, 1000}) {
+            for (bool modeMax : {true, false}) {
+                for (bool sortValue : {true, false}) {
+                    SCOPED_TRACE("k " + std::to_string(k) + (modeMax ? ", max" : ", min") +
+                                 (sortValue ? ", sort by value" : ", sort by index") + ", size " + std::to_string(size));
+                    checkTopK(src, dims, k, modeMax, sortValue);
+                }
+            }
+        }
+    }
+}
+
+TEST(TopKTest, NothingIsSelectedFromEmptyTensor) {
+    const SizeVector dims{0, 100};
+    std::vector<float> src;
+    src.reserve(1);
+    checkTopK(src, dims, 10, true, true);
+}
+
+TEST(TopKTest, NaNIsSelectedAsTheLargestValue) {
+    // the heap selection path, with a single row it is also split between the threads
+    for (const auto& dims : {SizeVector{2, 1000}, SizeVector{1, 70000}}) {
+        const size_t n = dims[1];
+        std::vector<float> src(dims[0] * n);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = i % 97 == 0 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>((i * 7919) % n);
+
+        for (bool modeMax : {true, false}) {
+            SCOPED_TRACE(modeMax ? "max" : "min");
+            checkTopK(src, dims, 100, modeMax, true);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "mkldnn_plugin.h"
+#include "mkldnn_exec_network.h"
+#include "mkldnn_infer_request.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+// Debug allocator hook: counts heap allocations made by the current thread while a counter scope is alive
+thread_local bool countAllocations = false;
+thread_local size_t allocationsCount = 0;
+
+struct AllocationCounterScope {
+    AllocationCounterScope() {
+        allocationsCount = 0;
+        countAllocations = true;
+    }
+    ~AllocationCounterScope() {
+        countAllocations = false;
+    }
+    size_t count() const {
+        return allocationsCount;
+    }
+};
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (countAllocations)
+        allocationsCount++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+TEST(InferRequestTest, SteadyStateInferDoesNotAllocate) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    auto add = std::make_shared<ngraph::opset1::Add>(relu, param);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{param});
+    CNNNetwork network(function);
+
+    Engine engine;
+    auto execNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(engine.LoadExeNetworkImpl(network, {}));
+    ASSERT_NE(nullptr, execNetwork);
+    auto request = std::dynamic_pointer_cast<MKLDNNInferRequest>(
+        execNetwork->CreateInferRequestImpl(network.getInputsInfo(), network.getOutputsInfo()));
+    ASSERT_NE(nullptr, request);
+
+    // The first inference is allowed to allocate everything it needs for the fixed shape
+    request->InferImpl();
+    request->InferImpl();
+
+    for (int i = 0; i < 10; i++) {
+        size_t allocations = 0;
+        {
+            AllocationCounterScope counter;
+            request->InferImpl();
+            allocations = counter.count();
+        }
+        ASSERT_EQ(0, allocations) << "Heap allocations detected in InferImpl at iteration " << i;
+    }
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+namespace {
+class CPUStreamsExecutorPriorityTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _executor = std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"PriorityCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        // the only stream is blocked so all the following tasks are queued before any of them is started
+        std::promise<void> started;
+        _executor->run([this, &started] {
+            started.set_value();
+            _unblock.get_future().wait();
+        });
+        started.get_future().wait();
+    }
+
+    void TearDown() override {
+        _executor.reset();
+    }
+
+    void runWithPriority(int id, int priority, TaskPriority::Clock::time_point deadline = TaskPriority::Clock::time_point::max()) {
+        TaskPriority taskPriority;
+        taskPriority._priority = priority;
+        taskPriority._deadline = deadline;
+        _executor->runWithPriority([this, id] {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _order.push_back(id);
+        }, taskPriority);
+    }
+
+    std::vector<int> waitForOrder(std::size_t tasksNum) {
+        _unblock.set_value();
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_order.size() == tasksNum) {
+                    return _order;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    std::shared_ptr<CPUStreamsExecutor> _executor;
+    std::promise<void>                  _unblock;
+    std::mutex                          _mutex;
+    std::vector<int>                    _order;
+};
+}  // namespace
+
+TEST_F(CPUStreamsExecutorPriorityTest, HighPriorityTasksAreStartedFirst) {
+    runWithPriority(0, -1);
+    runWithPriority(1, 0);
+    runWithPriority(2, 1);
+    runWithPriority(3, 2);
+    ASSERT_EQ((std::vector<int>{3, 2, 1, 0}), waitForOrder(4));
+}
+
+TEST_F(CPUStreamsExecutorPriorityTest, TasksWithSamePriorityAreStartedInDeadlineOrder) {
+    auto now = TaskPriority::Clock::now();
+    runWithPriority(0, 1);
+    runWithPriority(1, 1, now + std::chrono::seconds{3});
+    runWithPriority(2, 1, now + std::chrono::seconds{1});
+    runWithPriority(3, 1, now + std::chrono::seconds{2});
+    ASSERT_EQ((std::vector<int>{2, 3, 1, 0}), waitForOrder(4));
+}
+
+TEST_F(CPUStreamsExecutorPriorityTest, DefaultTasksAreNotStarvedByHighPriorityOnes) {
+    runWithPriority(0, 0);
+    const int highPriorityTasksNum = 32;
+    for (int i = 1; i <= highPriorityTasksNum; ++i) {
+        runWithPriority(i, 1);
+    }
+    auto order = waitForOrder(highPriorityTasksNum + 1);
+    auto defaultTaskPosition = std::find(order.begin(), order.end(), 0) - order.begin();
+    ASSERT_LT(defaultTaskPosition, highPriorityTasksNum);
+}
+
+TEST_F(CPUStreamsExecutorPriorityTest, QueueingDelayIsCollectedPerPriority) {
+    auto now = TaskPriority::Clock::now();
+    runWithPriority(0, -1);
+    runWithPriority(1, 0);
+    runWithPriority(2, 0, now + std::chrono::seconds{1});
+    runWithPriority(3, 1);
+    runWithPriority(4, 1);
+    waitForOrder(5);
+    auto statistics = _executor->GetQueueingStatistics();
+    ASSERT_EQ(3u, statistics.size());
+    ASSERT_EQ(1u, statistics[-1]._tasks);
+    ASSERT_EQ(1u, statistics[0]._tasks);
+    ASSERT_EQ(2u, statistics[1]._tasks);
+    ASSERT_GE(statistics[-1]._maxDelayMs, statistics[1]._maxDelayMs);
+}
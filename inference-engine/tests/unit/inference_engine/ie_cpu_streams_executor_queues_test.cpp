@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include <atomic>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+TEST(CPUStreamsExecutorQueuesTest, AllTasksAreExecutedWhenQueuesOverflow) {
+    std::atomic<int> done = {0};
+    const int tasksNum = 100000;
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"OverflowCPUStreamsExecutor", 2, 1,
+                                                             IStreamsExecutor::ThreadBindingType::NONE}};
+        for (int i = 0; i < tasksNum; ++i) {
+            executor.run([&] { ++done; });
+        }
+    }
+    ASSERT_EQ(tasksNum, done.load());
+}
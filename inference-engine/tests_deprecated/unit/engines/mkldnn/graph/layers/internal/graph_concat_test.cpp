@@ -232,6 +232,16 @@ INSTANTIATE_TEST_CASE_P(
                         {1, 64, 16, 16, 16, 1},
                         {1, 64, 16, 16, 16, 1},
                         5, 1, MKLDNNPlugin::impl_desc_type::ref
+                },
+                concat_test_params {
+                        {1, 1, 3, 5},
+                        {1, 1, 4, 5},
+                        2, 2, MKLDNNPlugin::impl_desc_type::unknown
+                },
+                concat_test_params {
+                        {1, 16, 1, 5},
+                        {1, 16, 1, 7},
+                        3, 4, MKLDNNPlugin::impl_desc_type::unknown
                 }));
 
 class MKLDNNGraphDynBatchConcatTests: public TestsCommon, public WithParamInterface<concat_test_params> {
@@ -426,6 +436,11 @@ INSTANTIATE_TEST_CASE_P(
                         {2, 2, 3, 3, 3},
                         {2, 3, 3, 3, 3},
                         1, 2, MKLDNNPlugin::impl_desc_type::unknown
+                },
+                concat_test_params {
+                        {2, 1, 3, 5},
+                        {2, 1, 4, 5},
+                        2, 2, MKLDNNPlugin::impl_desc_type::unknown
                 }));
 
 struct concat_param {
@@ -6669,3 +6669,220 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     compare(*outputBlobs["concat"], *dstOut);
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestCloneGraphHasOwnWorkspace) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <data negative_slope="0" engine="caffe.ReLUParameter.DEFAULT"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool" type="Pooling" precision="FP32" id="3">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {448}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, weights_ptr));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network);
+
+    MKLDNNGraphTestClass copy;
+    MKLDNNPlugin::MKLDNNWeightsSharing::Ptr weightsCache;
+    ASSERT_TRUE(copy.CloneGraph(graph, weightsCache));
+    ASSERT_TRUE(copy.IsReady());
+
+    auto& nodes = graph.getNodes();
+    auto& copiedNodes = copy.getNodes();
+    ASSERT_EQ(nodes.size(), copiedNodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_NE(nodes[i], copiedNodes[i]);
+        ASSERT_EQ(nodes[i]->getName(), copiedNodes[i]->getName());
+        ASSERT_EQ(nodes[i]->getParentEdges().size(), copiedNodes[i]->getParentEdges().size());
+        ASSERT_EQ(nodes[i]->getChildEdges().size(), copiedNodes[i]->getChildEdges().size());
+        for (size_t j = 0; j < nodes[i]->getChildEdges().size(); j++) {
+            if (!nodes[i]->isConstant())
+                ASSERT_NE(nodes[i]->getChildEdgeAt(j)->getMemory().GetData(), copiedNodes[i]->getChildEdgeAt(j)->getMemory().GetData());
+        }
+    }
+
+    InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    auto infer = [&](MKLDNNGraphTestClass& g, float value) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        float *data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            data[i] = (i % 3) ? value : -value;
+        InferenceEngine::BlobMap srcs = {{"data", src}};
+
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs = {{item.first, output}};
+        g.Infer(srcs, outputBlobs);
+        return output;
+    };
+
+    // the copy runs with other data in between, the results must not depend on each other
+    auto expected = infer(graph, 1.f);
+    infer(copy, 2.f);
+    auto copiedOut = infer(copy, 1.f);
+    infer(graph, 3.f);
+    compare(*copiedOut, *expected);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMemoryBudgetReleasesLongLivedTensor) {
+    // 1 MB tensors, the output of relu is needed by the first convolution and by the product at the end only.
+    // Unlike the sum the product isn't fused into the convolution, so it doesn't share the memory with relu in-place.
+    const std::string dims = "<dim>1</dim><dim>16</dim><dim>128</dim><dim>128</dim>";
+    const size_t convWeightsSize = (16 * 16 * 3 * 3 + 16) * sizeof(float);
+    auto port = [&](int id) {
+        return "<port id=\"" + std::to_string(id) + "\">" + dims + "</port>";
+    };
+    auto conv = [&](int id) {
+        return "<layer name=\"conv" + std::to_string(id) + "\" type=\"Convolution\" precision=\"FP32\" id=\"" + std::to_string(id) + "\">"
+               "<convolution_data stride-x=\"1\" stride-y=\"1\" pad-x=\"1\" pad-y=\"1\" kernel-x=\"3\" kernel-y=\"3\" output=\"16\" group=\"1\"/>"
+               "<input>" + port(0) + "</input><output>" + port(1) + "</output>"
+               "<weights offset=\"" + std::to_string((id - 2) * convWeightsSize) + "\" size=\"" + std::to_string(convWeightsSize - 64) + "\"/>"
+               "<biases offset=\"" + std::to_string((id - 2) * convWeightsSize + convWeightsSize - 64) + "\" size=\"64\"/>"
+               "</layer>";
+    };
+    std::string model = "<net name=\"net\" version=\"2\" batch=\"1\"><layers>"
+            "<layer name=\"data\" type=\"Input\" precision=\"FP32\" id=\"0\"><output>" + port(0) + "</output></layer>"
+            "<layer name=\"relu\" type=\"ReLU\" precision=\"FP32\" id=\"1\"><data negative_slope=\"0\"/>"
+            "<input>" + port(0) + "</input><output>" + port(1) + "</output></layer>" +
+            conv(2) + conv(3) + conv(4) + conv(5) +
+            "<layer name=\"mul\" type=\"Eltwise\" precision=\"FP32\" id=\"6\"><elementwise_data operation=\"mul\"/>"
+            "<input>" + port(0) + port(1) + "</input><output>" + port(2) + "</output></layer>"
+            "</layers><edges>"
+            "<edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"0\"/>"
+            "<edge from-layer=\"1\" from-port=\"1\" to-layer=\"2\" to-port=\"0\"/>"
+            "<edge from-layer=\"2\" from-port=\"1\" to-layer=\"3\" to-port=\"0\"/>"
+            "<edge from-layer=\"3\" from-port=\"1\" to-layer=\"4\" to-port=\"0\"/>"
+            "<edge from-layer=\"4\" from-port=\"1\" to-layer=\"5\" to-port=\"0\"/>"
+            "<edge from-layer=\"1\" from-port=\"1\" to-layer=\"6\" to-port=\"0\"/>"
+            "<edge from-layer=\"5\" from-port=\"1\" to-layer=\"6\" to-port=\"1\"/>"
+            "</edges></net>";
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {4 * convWeightsSize}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, weights_ptr));
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 16, 128, 128}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    InferenceEngine::BlobMap srcs = {{"data", src}};
+
+    InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    auto infer = [&](MKLDNNGraphTestClass& graph) {
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs = {{item.first, output}};
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    };
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network);
+    auto expected = infer(graph);
+
+    MKLDNNGraphTestClass limitedGraph;
+    limitedGraph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_BUDGET_MB, "1"}});
+    limitedGraph.CreateGraph(network);
+
+    const auto& statistics = graph.GetMemoryStatistics();
+    const auto& limitedStatistics = limitedGraph.GetMemoryStatistics();
+    ASSERT_EQ(0u, statistics.recomputedTensors + statistics.spilledTensors);
+    ASSERT_LT(0u, limitedStatistics.recomputedTensors + limitedStatistics.spilledTensors);
+    ASSERT_LT(limitedStatistics.workspaceSize, statistics.workspaceSize);
+    ASSERT_LE(limitedStatistics.peakLiveSize, limitedStatistics.workspaceSize);
+
+    // the released data is brought back on each inference
+    for (int i = 0; i < 2; i++)
+        compare(*infer(limitedGraph), *expected);
+}
@@ -95,8 +95,16 @@ namespace ngraph
         // updates graph and m_results list
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
+        /// \brief Revalidates all the nodes of the function in topological order
         void validate_nodes_and_infer_types() const;
 
+        /// \brief Revalidates only the nodes changed since the previous validation and the
+        ///        nodes their changes may propagate to. A node is revalidated if it is marked by
+        ///        Node::mark_for_revalidation, if the element type or shape of its input changed,
+        ///        or if the value of its input may have changed and can be used for the shape
+        ///        inference, i.e. is not computed from the Parameter data.
+        void validate_marked_nodes_and_infer_types() const;
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -191,6 +199,7 @@ namespace ngraph
         Function& operator=(const Function&) = delete;
         /// \brief Checks all the Parameter nodes are registered in the list of Function parameters
         void check_all_parameters_registered() const;
+        void validate_nodes(bool only_marked) const;
 
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
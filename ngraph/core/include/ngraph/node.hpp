@@ -231,6 +231,13 @@ namespace ngraph
             invalidate_values();
             validate_and_infer_types();
         }
+        /// \brief Requests revalidation of the node by the next incremental validation of the
+        ///        function, see Function::validate_marked_nodes_and_infer_types. The node is
+        ///        marked automatically when its inputs are replaced or the element type or shape
+        ///        of an input changes; operations mark themselves in attribute setters.
+        void mark_for_revalidation() { m_revalidation_required = true; }
+        /// \returns true if the node has to be revalidated by the incremental validation
+        bool is_marked_for_revalidation() const { return m_revalidation_required; }
         /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
         ///        The class name, must not contain spaces as it is used for codegen.
         /// \returns A const reference to the node's type name
@@ -482,6 +489,9 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        bool m_revalidation_required{true};
+
+        friend class Function;
     };
 
     using NodeTypeInfo = Node::type_info_t;
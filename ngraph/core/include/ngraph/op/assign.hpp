@@ -30,6 +30,7 @@ namespace ngraph
             virtual void set_variable(const std::shared_ptr<ngraph::Variable>& variable)
             {
                 m_variable = variable;
+                mark_for_revalidation();
             }
 
             /// \brief Sets the identifier of corresponding variable
@@ -64,6 +65,7 @@ namespace ngraph
                 void set_variable_id(const std::string& variable_id) override
                 {
                     m_variable_id = variable_id;
+                    mark_for_revalidation();
                 }
 
                 std::shared_ptr<Node>
@@ -39,7 +39,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 double get_eps_value() const { return m_epsilon; }
-                void set_eps_value(double epsilon) { m_epsilon = epsilon; }
+                void set_eps_value(double epsilon)
+                {
+                    m_epsilon = epsilon;
+                    mark_for_revalidation();
+                }
                 std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
@@ -78,7 +82,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 double get_eps_value() const { return m_epsilon; }
-                void set_eps_value(double epsilon) { m_epsilon = epsilon; }
+                void set_eps_value(double epsilon)
+                {
+                    m_epsilon = epsilon;
+                    mark_for_revalidation();
+                }
                 std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
@@ -62,6 +62,7 @@ namespace ngraph
                 void set_broadcast_spec(const BroadcastModeSpec& broadcast_spec)
                 {
                     m_mode = broadcast_spec;
+                    mark_for_revalidation();
                 }
 
                 void validate_and_infer_types() override;
@@ -127,6 +128,7 @@ namespace ngraph
                 void set_broadcast_spec(const AutoBroadcastSpec& broadcast_spec)
                 {
                     m_broadcast_spec = broadcast_spec;
+                    mark_for_revalidation();
                 }
 
                 void validate_and_infer_types() override;
@@ -38,7 +38,11 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& inputs) const override;
 
                 element::Type get_output_type() const { return m_output_type; }
-                void set_output_type(element::Type output_type) { m_output_type = output_type; }
+                void set_output_type(element::Type output_type)
+                {
+                    m_output_type = output_type;
+                    mark_for_revalidation();
+                }
                 // Overload collision with method on Node
                 using Node::set_output_type;
 
@@ -46,6 +50,7 @@ namespace ngraph
                 void set_with_right_bound(bool with_right_bound)
                 {
                     m_with_right_bound = with_right_bound;
+                    mark_for_revalidation();
                 }
 
             private:
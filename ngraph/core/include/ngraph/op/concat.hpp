@@ -45,10 +45,15 @@ namespace ngraph
                 void set_concatenation_axis(int64_t concatenation_axis)
                 {
                     m_concat_axis = concatenation_axis;
+                    mark_for_revalidation();
                 }
                 /// \return The concatenation axis.
                 int64_t get_axis() const { return m_axis; }
-                void set_axis(int64_t axis) { m_axis = axis; }
+                void set_axis(int64_t axis)
+                {
+                    m_axis = axis;
+                    mark_for_revalidation();
+                }
                 bool evaluate(const HostTensorVector& outputs,
                               const HostTensorVector& inputs) const override;
                 bool evaluate_lower(const HostTensorVector& output_values) const override;
@@ -73,6 +73,7 @@ namespace ngraph
                 {
                     m_classes_index_type = classes_index_type;
                     validate_and_infer_types();
+                    mark_for_revalidation();
                 }
 
                 /// \brief Get sequence_length_type attribute
@@ -92,6 +93,7 @@ namespace ngraph
                 {
                     m_sequence_length_type = sequence_length_type;
                     validate_and_infer_types();
+                    mark_for_revalidation();
                 }
 
             private:
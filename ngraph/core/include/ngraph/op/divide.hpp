@@ -46,7 +46,11 @@ namespace ngraph
                            AutoBroadcastSpec(AutoBroadcastType::NUMPY));
                 bool visit_attributes(AttributeVisitor& visitor) override;
                 bool is_pythondiv() const { return m_pythondiv; }
-                void set_is_pythondiv(bool pythondiv) { m_pythondiv = pythondiv; }
+                void set_is_pythondiv(bool pythondiv)
+                {
+                    m_pythondiv = pythondiv;
+                    mark_for_revalidation();
+                }
                 virtual std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
@@ -40,13 +40,29 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 const Shape& get_sizes() const { return m_patch_sizes; }
-                void set_sizes(const Shape& sizes) { m_patch_sizes = sizes; }
+                void set_sizes(const Shape& sizes)
+                {
+                    m_patch_sizes = sizes;
+                    mark_for_revalidation();
+                }
                 const Strides& get_strides() const { return m_patch_movement_strides; }
-                void set_strides(const Strides& strides) { m_patch_movement_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_patch_movement_strides = strides;
+                    mark_for_revalidation();
+                }
                 const Shape& get_rates() const { return m_patch_selection_rates; }
-                void set_rates(const Shape& rates) { m_patch_selection_rates = rates; }
+                void set_rates(const Shape& rates)
+                {
+                    m_patch_selection_rates = rates;
+                    mark_for_revalidation();
+                }
                 const PadType& get_auto_pad() const { return m_padding; }
-                void set_auto_pad(PadType& padding) { m_padding = padding; }
+                void set_auto_pad(PadType& padding)
+                {
+                    m_padding = padding;
+                    mark_for_revalidation();
+                }
 
             private:
                 Shape m_patch_sizes;
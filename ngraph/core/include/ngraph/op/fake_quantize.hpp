@@ -61,11 +61,16 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 std::size_t get_levels() const { return m_levels; }
-                void set_levels(std::size_t levels) { m_levels = levels; }
+                void set_levels(std::size_t levels)
+                {
+                    m_levels = levels;
+                    mark_for_revalidation();
+                }
                 const AutoBroadcastSpec& get_auto_broadcast() const { return m_auto_broadcast; }
                 void set_auto_broadcast(const AutoBroadcastSpec& auto_broadcast)
                 {
                     m_auto_broadcast = auto_broadcast;
+                    mark_for_revalidation();
                 }
 
             private:
@@ -57,19 +57,39 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
                 /// \return The strides.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_for_revalidation();
+                }
                 /// \return The dilations.
                 const Strides& get_dilations() const { return m_dilations; }
-                void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+                void set_dilations(const Strides& dilations)
+                {
+                    m_dilations = dilations;
+                    mark_for_revalidation();
+                }
                 /// \return The padding-below sizes (possibly negative).
                 const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const CoordinateDiff& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_for_revalidation();
+                }
                 /// \return The padding-above sizes (possibly negative).
                 const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-                void set_adding_above(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+                void set_adding_above(const CoordinateDiff& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_for_revalidation();
+                }
                 /// \return The pad type for convolution.
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_for_revalidation();
+                }
                 /// \return The default value for Convolution.
                 virtual std::shared_ptr<Node> get_default_value() const override;
 
@@ -206,24 +226,45 @@ namespace ngraph
                 void set_output_shape(const Shape& output_shape);
                 /// \return The strides from the forward prop.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_for_revalidation();
+                }
                 /// \return The dilations from the forward prop.
                 const Strides& get_dilations() const { return m_dilations; }
-                void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+                void set_dilations(const Strides& dilations)
+                {
+                    m_dilations = dilations;
+                    mark_for_revalidation();
+                }
                 /// \return The number of pixels to add to the beginning along each axis.
                 const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const CoordinateDiff& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_for_revalidation();
+                }
                 /// \return The number of pixels to add to the ending along each axis.
                 const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-                void set_pads_end(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+                void set_pads_end(const CoordinateDiff& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_for_revalidation();
+                }
                 /// \return The auto pad.
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_for_revalidation();
+                }
                 /// \return The output padding.
                 const CoordinateDiff& get_output_padding() const { return m_output_padding; }
                 void set_output_padding(const CoordinateDiff& output_padding)
                 {
                     m_output_padding = output_padding;
+                    mark_for_revalidation();
                 }
 
             protected:
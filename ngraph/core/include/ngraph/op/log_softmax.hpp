@@ -35,7 +35,11 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 int64_t get_axis() const { return m_axis; }
-                void set_axis(const int64_t axis) { m_axis = axis; }
+                void set_axis(const int64_t axis)
+                {
+                    m_axis = axis;
+                    mark_for_revalidation();
+                }
 
             private:
                 int64_t m_axis = 1;
@@ -62,6 +62,7 @@ namespace ngraph
                 void set_special_body_ports(const SpecialBodyPorts& special_body_ports)
                 {
                     m_special_body_ports = special_body_ports;
+                    mark_for_revalidation();
                 }
 
                 SpecialBodyPorts get_special_body_ports() const { return m_special_body_ports; }
@@ -52,13 +52,29 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 double get_alpha() const { return m_alpha; }
-                void set_alpha(double alpha) { m_alpha = alpha; }
+                void set_alpha(double alpha)
+                {
+                    m_alpha = alpha;
+                    mark_for_revalidation();
+                }
                 double get_beta() const { return m_beta; }
-                void set_beta(double beta) { m_beta = beta; }
+                void set_beta(double beta)
+                {
+                    m_beta = beta;
+                    mark_for_revalidation();
+                }
                 double get_bias() const { return m_bias; }
-                void set_bias(double bias) { m_bias = bias; }
+                void set_bias(double bias)
+                {
+                    m_bias = bias;
+                    mark_for_revalidation();
+                }
                 size_t get_nsize() const { return m_size; }
-                void set_nsize(size_t size) { m_size = size; }
+                void set_nsize(size_t size)
+                {
+                    m_size = size;
+                    mark_for_revalidation();
+                }
                 AxisSet get_reduction_axes() const;
 
             protected:
@@ -41,8 +41,16 @@ namespace ngraph
 
                 bool get_transpose_a() const { return m_transpose_a; }
                 bool get_transpose_b() const { return m_transpose_b; }
-                void set_transpose_a(bool transpose_a) { m_transpose_a = transpose_a; }
-                void set_transpose_b(bool transpose_b) { m_transpose_b = transpose_b; }
+                void set_transpose_a(bool transpose_a)
+                {
+                    m_transpose_a = transpose_a;
+                    mark_for_revalidation();
+                }
+                void set_transpose_b(bool transpose_b)
+                {
+                    m_transpose_b = transpose_b;
+                    mark_for_revalidation();
+                }
 
             private:
                 bool m_transpose_a;
@@ -49,24 +49,45 @@ namespace ngraph
 
                 /// \return The kernel shape.
                 const Shape& get_kernel() const { return m_kernel; }
-                void set_kernel(const Shape& kernel) { m_kernel = kernel; }
+                void set_kernel(const Shape& kernel)
+                {
+                    m_kernel = kernel;
+                    mark_for_revalidation();
+                }
                 /// \return The strides.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_for_revalidation();
+                }
                 /// \return The beginning of padding shape.
                 const Shape& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const Shape& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const Shape& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_for_revalidation();
+                }
                 /// \return The end of padding shape.
                 const Shape& get_pads_end() const { return m_pads_end; }
-                void set_adding_above(const Shape& pads_end) { m_pads_end = pads_end; }
+                void set_adding_above(const Shape& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_for_revalidation();
+                }
                 /// \return The pad type for pooling.
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_for_revalidation();
+                }
                 /// \return The ceiling mode being used for output shape computations
                 op::RoundingType get_rounding_type() const { return m_rounding_type; }
                 void set_rounding_type(op::RoundingType rounding_mode)
                 {
                     m_rounding_type = rounding_mode;
+                    mark_for_revalidation();
                 }
                 /// \return The default value for MaxPool.
                 virtual std::shared_ptr<Node> get_default_value() const override;
@@ -66,7 +66,11 @@ namespace ngraph
                 bool get_across_channels() const { return m_across_channels; }
                 bool get_normalize_variance() const { return m_normalize_variance; }
                 AxisSet get_reduction_axes() const { return m_reduction_axes; }
-                void set_reduction_axes(AxisSet axes) { m_reduction_axes = axes; }
+                void set_reduction_axes(AxisSet axes)
+                {
+                    m_reduction_axes = axes;
+                    mark_for_revalidation();
+                }
 
             private:
                 double m_eps = 1e-9;
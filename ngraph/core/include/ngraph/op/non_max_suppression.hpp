@@ -68,11 +68,13 @@ namespace ngraph
                 void set_box_encoding(const BoxEncodingType box_encoding)
                 {
                     m_box_encoding = box_encoding;
+                    mark_for_revalidation();
                 }
                 bool get_sort_result_descending() const { return m_sort_result_descending; }
                 void set_sort_result_descending(const bool sort_result_descending)
                 {
                     m_sort_result_descending = sort_result_descending;
+                    mark_for_revalidation();
                 }
 
             protected:
@@ -147,17 +149,20 @@ namespace ngraph
                 void set_box_encoding(const BoxEncodingType box_encoding)
                 {
                     m_box_encoding = box_encoding;
+                    mark_for_revalidation();
                 }
                 bool get_sort_result_descending() const { return m_sort_result_descending; }
                 void set_sort_result_descending(const bool sort_result_descending)
                 {
                     m_sort_result_descending = sort_result_descending;
+                    mark_for_revalidation();
                 }
 
                 element::Type get_output_type() const { return m_output_type; }
                 void set_output_type(const element::Type& output_type)
                 {
                     m_output_type = output_type;
+                    mark_for_revalidation();
                 }
                 using Node::set_output_type;
 
@@ -348,17 +353,20 @@ namespace ngraph
                 void set_box_encoding(const BoxEncodingType box_encoding)
                 {
                     m_box_encoding = box_encoding;
+                    mark_for_revalidation();
                 }
                 bool get_sort_result_descending() const { return m_sort_result_descending; }
                 void set_sort_result_descending(const bool sort_result_descending)
                 {
                     m_sort_result_descending = sort_result_descending;
+                    mark_for_revalidation();
                 }
 
                 element::Type get_output_type() const { return m_output_type; }
                 void set_output_type(const element::Type& output_type)
                 {
                     m_output_type = output_type;
+                    mark_for_revalidation();
                 }
                 using Node::set_output_type;
 
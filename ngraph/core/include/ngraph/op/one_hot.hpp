@@ -45,7 +45,11 @@ namespace ngraph
 
                 /// \return The index of the one-hot axis.
                 int64_t get_axis() const { return m_axis; }
-                void set_axis(int64_t axis) { m_axis = axis; }
+                void set_axis(int64_t axis)
+                {
+                    m_axis = axis;
+                    mark_for_revalidation();
+                }
 
             protected:
                 int64_t m_axis;
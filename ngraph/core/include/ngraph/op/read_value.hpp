@@ -40,6 +40,7 @@ namespace ngraph
             virtual void set_variable(const std::shared_ptr<ngraph::Variable>& variable)
             {
                 m_variable = variable;
+                mark_for_revalidation();
             }
 
         protected:
@@ -72,6 +73,7 @@ namespace ngraph
                 void set_variable_id(const std::string& variable_id) override
                 {
                     m_variable_id = variable_id;
+                    mark_for_revalidation();
                 }
 
             private:
@@ -51,7 +51,11 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 bool get_special_zero() const { return m_special_zero; }
-                void set_special_zero(bool special_zero) { m_special_zero = special_zero; }
+                void set_special_zero(bool special_zero)
+                {
+                    m_special_zero = special_zero;
+                    mark_for_revalidation();
+                }
                 bool evaluate(const HostTensorVector& outputs,
                               const HostTensorVector& inputs) const override;
                 bool evaluate_lower(const HostTensorVector& outputs) const override;
@@ -32,7 +32,11 @@ namespace ngraph
                 virtual std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
-                void set_needs_default_layout(bool val) { m_needs_default_layout = val; }
+                void set_needs_default_layout(bool val)
+                {
+                    m_needs_default_layout = val;
+                    mark_for_revalidation();
+                }
                 bool needs_default_layout() const { return m_needs_default_layout; }
                 bool evaluate(const HostTensorVector& outputs,
                               const HostTensorVector& inputs) const override;
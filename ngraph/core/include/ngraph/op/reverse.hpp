@@ -46,7 +46,11 @@ namespace ngraph
 
                 /// \return The second input data interpretation mode.
                 Mode get_mode() const { return m_mode; }
-                void set_mode(const Mode mode) { m_mode = mode; }
+                void set_mode(const Mode mode)
+                {
+                    m_mode = mode;
+                    mark_for_revalidation();
+                }
                 virtual size_t get_version() const override { return 1; }
                 bool evaluate(const HostTensorVector& outputs,
                               const HostTensorVector& inputs) const override;
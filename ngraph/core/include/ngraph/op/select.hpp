@@ -62,6 +62,7 @@ namespace ngraph
                 void set_auto_broadcast(const AutoBroadcastSpec& auto_broadcast)
                 {
                     m_auto_broadcast = auto_broadcast;
+                    mark_for_revalidation();
                 }
                 // TODO: Move all uses of get_autob to get_auto_broadcast() and remove this.
                 const AutoBroadcastSpec& get_autob() const override { return m_auto_broadcast; }
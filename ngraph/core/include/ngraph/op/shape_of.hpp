@@ -29,7 +29,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 element::Type get_output_type() const { return m_output_type; }
-                void set_output_type(element::Type output_type) { m_output_type = output_type; }
+                void set_output_type(element::Type output_type)
+                {
+                    m_output_type = output_type;
+                    mark_for_revalidation();
+                }
                 // Overload collision with method on Node
                 using Node::set_output_type;
 
@@ -39,7 +43,11 @@ namespace ngraph
                 // In this case we need to prevent constant folding from endless creation of these
                 // subgraphs.
                 // These metods should be removed if better solution will be designed.
-                void set_is_foldable(bool is_foldable) { m_is_foldable = is_foldable; }
+                void set_is_foldable(bool is_foldable)
+                {
+                    m_is_foldable = is_foldable;
+                    mark_for_revalidation();
+                }
                 bool get_is_foldable() const { return m_is_foldable; }
                 bool evaluate(const HostTensorVector& output_values,
                               const HostTensorVector& input_values) const override;
@@ -77,7 +85,11 @@ namespace ngraph
                 // In this case we need to prevent constant folding from endless creation of these
                 // subgraphs.
                 // These metods should be removed if better solution will be designed.
-                void set_is_foldable(bool is_foldable) { m_is_foldable = is_foldable; }
+                void set_is_foldable(bool is_foldable)
+                {
+                    m_is_foldable = is_foldable;
+                    mark_for_revalidation();
+                }
                 bool get_is_foldable() const { return m_is_foldable; }
                 bool evaluate(const HostTensorVector& output_values,
                               const HostTensorVector& input_values) const override;
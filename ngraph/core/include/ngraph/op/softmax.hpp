@@ -39,7 +39,11 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 size_t get_axis() const { return m_axis; }
-                void set_axis(const size_t axis) { m_axis = axis; }
+                void set_axis(const size_t axis)
+                {
+                    m_axis = axis;
+                    mark_for_revalidation();
+                }
                 bool evaluate(const HostTensorVector& outputs,
                               const HostTensorVector& inputs) const override;
 
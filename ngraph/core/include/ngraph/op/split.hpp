@@ -38,7 +38,11 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 size_t get_num_splits() const { return m_num_splits; }
-                void set_num_splits(const size_t num_splits) { m_num_splits = num_splits; }
+                void set_num_splits(const size_t num_splits)
+                {
+                    m_num_splits = num_splits;
+                    mark_for_revalidation();
+                }
                 bool evaluate(const HostTensorVector& outputs,
                               const HostTensorVector& inputs) const override;
 
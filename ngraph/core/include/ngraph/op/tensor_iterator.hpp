@@ -32,7 +32,11 @@ namespace ngraph
                 /// \return the body of the iteration
                 std::shared_ptr<Function> get_body() const { return m_body; }
                 /// \param body set the body of the iteration
-                void set_body(const std::shared_ptr<Function>& body) { m_body = body; }
+                void set_body(const std::shared_ptr<Function>& body)
+                {
+                    m_body = body;
+                    mark_for_revalidation();
+                }
                 void validate_and_infer_types() override;
                 void revalidate_and_infer_types_for_body_ops();
                 /// \return the body of the iteration
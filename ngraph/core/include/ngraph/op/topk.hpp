@@ -69,13 +69,22 @@ namespace ngraph
                 int64_t get_provided_axis() const { return m_axis; }
                 void set_axis(const int64_t axis);
                 Mode get_mode() const { return m_mode; }
-                void set_mode(const Mode mode) { m_mode = mode; }
+                void set_mode(const Mode mode)
+                {
+                    m_mode = mode;
+                    mark_for_revalidation();
+                }
                 SortType get_sort_type() const { return m_sort; }
-                void set_sort_type(const SortType sort) { m_sort = sort; }
+                void set_sort_type(const SortType sort)
+                {
+                    m_sort = sort;
+                    mark_for_revalidation();
+                }
                 element::Type get_index_element_type() const { return m_index_element_type; }
                 void set_index_element_type(const element::Type& index_element_type)
                 {
                     m_index_element_type = index_element_type;
+                    mark_for_revalidation();
                 }
                 /// \brief Returns the value of K, if available
                 ///
@@ -58,7 +58,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 const AutoBroadcastSpec& get_autob() const override { return m_autob; }
-                void set_autob(const AutoBroadcastSpec& autob) { m_autob = autob; }
+                void set_autob(const AutoBroadcastSpec& autob)
+                {
+                    m_autob = autob;
+                    mark_for_revalidation();
+                }
                 bool visit_attributes(AttributeVisitor& visitor) override;
                 bool evaluate_lower(const HostTensorVector& outputs) const override;
                 bool evaluate_upper(const HostTensorVector& outputs) const override;
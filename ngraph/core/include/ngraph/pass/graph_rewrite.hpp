@@ -105,9 +105,9 @@ namespace ngraph
         /// class.
         /// As a default algorithm graph rewrite pass traverse Function in topological order and
         /// applies
-        /// registered matcher passes for each node. But if all registered matcher passes have type
-        /// based
-        /// root node in Matcher pattern then efficient mechanism is used to execute them.
+        /// registered matcher passes for each node. Matcher passes with type based root node in
+        /// Matcher pattern are applied only to the nodes of the root type or the types derived
+        /// from it, the rest of matcher passes are applied to every node.
         /// Matcher pattern root is type based if it's operation from opset or
         /// pattern::op::WrapType.
         /// Note: when implementing pattern for Matcher make sure that root node is an operation
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Process wide collector of the transformations statistics.
+        ///
+        /// pass::Manager records every pass it runs and GraphRewrite records every matcher pass
+        /// it applies, including the GraphRewrite instances run outside of pass::Manager. The
+        /// statistics are aggregated by pass name over all the functions transformed by the
+        /// process until reset() is called, so the report of a network loading covers all the
+        /// pipelines run by the plugin.
+        ///
+        /// The profiler is enabled by set_enabled(true) or by the NGRAPH_PASS_PROFILE_REPORT
+        /// environment variable. The variable value is a path the JSON report is written to
+        /// after each outermost pass::Manager::run_passes and at the process exit:
+        ///
+        ///     NGRAPH_PASS_PROFILE_REPORT=passes.json ./benchmark_app -m model.xml
+        ///
+        /// Time of a pass includes the time of the passes and matchers it runs itself.
+        class NGRAPH_API Profiler
+        {
+        public:
+            struct Statistics
+            {
+                /// \brief Number of runs of the pass
+                size_t calls = 0;
+                /// \brief Number of nodes the matcher pass was applied to
+                size_t nodes_visited = 0;
+                /// \brief Number of nodes matched by the pattern of the matcher pass
+                size_t matches = 0;
+                /// \brief Number of runs which changed the function, for a matcher pass number of
+                /// callbacks which returned true
+                size_t rewrites = 0;
+                double time_ms = 0;
+            };
+            using StatisticsMap = std::map<std::string, Statistics>;
+
+            static Profiler& get();
+
+            Profiler(const Profiler&) = delete;
+            Profiler& operator=(const Profiler&) = delete;
+            ~Profiler();
+
+            bool is_enabled() const { return m_enabled; }
+            void set_enabled(bool enabled) { m_enabled = enabled; }
+            /// \brief Drops the collected statistics
+            void reset();
+
+            void add_pass(const std::string& name, double time_ms, bool changed);
+            void add_matcher(const std::string& name, const Statistics& statistics);
+
+            StatisticsMap get_pass_statistics() const;
+            StatisticsMap get_matcher_statistics() const;
+
+            /// \brief Writes the statistics as a JSON object with "passes" and "matchers" arrays
+            /// sorted by time
+            void write_json(std::ostream& stream) const;
+            /// \brief Writes the JSON report to the path set by NGRAPH_PASS_PROFILE_REPORT if
+            /// any
+            void write_report() const;
+
+        private:
+            Profiler();
+
+            std::atomic<bool> m_enabled{false};
+            std::string m_report_path;
+            mutable std::mutex m_mutex;
+            StatisticsMap m_passes;
+            StatisticsMap m_matchers;
+        };
+    } // namespace pass
+} // namespace ngraph
@@ -22,6 +22,10 @@ namespace ngraph
         /// pass does not break the shape and data type requirement on a computation node.
         /// This default validation run can be changed via calling the
         /// \link ngraph::pass::Manager::set_per_pass_validation(bool) \endlink function.
+        ///
+        /// All the nodes are revalidated. Set NGRAPH_ENABLE_INCREMENTAL_VALIDATION=1 to revalidate
+        /// only the nodes changed by the previous passes and the nodes the changes propagate to,
+        /// see \link ngraph::Function::validate_marked_nodes_and_infer_types() \endlink.
         class NGRAPH_API Validate : public FunctionPass
         {
         public:
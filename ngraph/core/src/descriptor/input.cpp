@@ -45,6 +45,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->mark_for_revalidation();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_set>
 #include <ngraph/ops.hpp>
 
 #include "itt.hpp"
@@ -91,10 +92,12 @@ void Function::check_all_parameters_registered() const
     OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraph, "Function::check_all_parameters_registered");
 
     std::stringstream unregistered_parameters;
+    std::unordered_set<Node*> registered_parameters;
+    for (const auto& param : m_parameters)
+        registered_parameters.insert(param.get());
     for (auto& node : get_ordered_ops())
     {
-        if (op::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
+        if (op::is_parameter(node) && !registered_parameters.count(node.get()))
             unregistered_parameters << node << std::endl;
     }
     if (!unregistered_parameters.str().empty())
@@ -105,7 +108,18 @@ void Function::check_all_parameters_registered() const
 void Function::validate_nodes_and_infer_types() const
 {
     OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraph, "Function::validate_nodes_and_infer_types");
+    validate_nodes(false);
+}
+
+void Function::validate_marked_nodes_and_infer_types() const
+{
+    OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraph,
+                       "Function::validate_marked_nodes_and_infer_types");
+    validate_nodes(true);
+}
 
+void Function::validate_nodes(bool only_marked) const
+{
     struct Counter
     {
         int cnt_assign = 0;
@@ -113,17 +127,54 @@ void Function::validate_nodes_and_infer_types() const
     };
     std::map<Variable*, Counter> pair_checker;
     std::stringstream unregistered_parameters;
+    std::unordered_set<Node*> registered_parameters;
+    for (const auto& param : m_parameters)
+        registered_parameters.insert(param.get());
+    // Nodes whose output values depend on the Parameter data. Shape inference of the consumers
+    // can't use such values, so their revalidation doesn't affect the consumers unless the
+    // output element type or shape changes.
+    std::unordered_set<Node*> data_dependent;
     for (auto& node : get_ordered_ops())
     {
-        node->revalidate_and_infer_types();
-        if (op::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
+        const auto assign = std::dynamic_pointer_cast<op::AssignBase>(node);
+        const auto read_value = std::dynamic_pointer_cast<op::ReadValueBase>(node);
+        bool is_data_dependent = op::is_parameter(node) || read_value;
+        if (only_marked && !is_data_dependent && !is_type<op::v0::ShapeOf>(node) &&
+            !is_type<op::v3::ShapeOf>(node))
+        {
+            for (const auto& input : node->inputs())
+            {
+                if (data_dependent.count(input.get_source_output().get_node()))
+                {
+                    is_data_dependent = true;
+                    break;
+                }
+            }
+        }
+        if (is_data_dependent)
+            data_dependent.insert(node.get());
+
+        // variables and bodies of sub-graphs are not tracked, so these nodes are always revalidated
+        if (!only_marked || node->m_revalidation_required || assign || read_value ||
+            std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+        {
+            node->revalidate_and_infer_types();
+            node->m_revalidation_required = false;
+            if (only_marked && !is_data_dependent)
+            {
+                for (const auto& output : node->outputs())
+                    for (const auto& input : output.get_target_inputs())
+                        input.get_node()->mark_for_revalidation();
+            }
+        }
+
+        if (op::is_parameter(node) && !registered_parameters.count(node.get()))
             unregistered_parameters << node << std::endl;
-        if (const auto& assign = std::dynamic_pointer_cast<op::AssignBase>(node))
+        if (assign)
         {
             pair_checker[assign->get_variable().get()].cnt_assign++;
         }
-        else if (const auto& read_value = std::dynamic_pointer_cast<op::ReadValueBase>(node))
+        else if (read_value)
         {
             pair_checker[read_value->get_variable().get()].cnt_read_val++;
         }
@@ -190,6 +190,7 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    mark_for_revalidation();
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -263,7 +264,16 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    auto& output = get_output_descriptor(i);
+    auto tensor = output.get_tensor_ptr();
+    // consumers have to be revalidated by the incremental validation only if the type changed
+    if (tensor->get_element_type() != element_type ||
+        !tensor->get_partial_shape().same_scheme(pshape))
+    {
+        for (auto input : output.get_inputs())
+            input->get_raw_pointer_node()->mark_for_revalidation();
+    }
+    tensor->set_tensor_type(element_type, pshape);
 }
 
 std::string Node::description() const
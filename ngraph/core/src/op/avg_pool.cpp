@@ -159,6 +159,7 @@ const Shape& op::v1::AvgPool::get_kernel() const
 void op::v1::AvgPool::set_kernel(const Shape& kernel)
 {
     m_kernel = kernel;
+    mark_for_revalidation();
 }
 
 const Strides& op::v1::AvgPool::get_strides() const
@@ -169,6 +170,7 @@ const Strides& op::v1::AvgPool::get_strides() const
 void op::v1::AvgPool::set_strides(const Strides& strides)
 {
     m_strides = strides;
+    mark_for_revalidation();
 }
 
 const Shape& op::v1::AvgPool::get_pads_begin() const
@@ -179,6 +181,7 @@ const Shape& op::v1::AvgPool::get_pads_begin() const
 void op::v1::AvgPool::set_pads_begin(const Shape& pads_begin)
 {
     m_pads_begin = pads_begin;
+    mark_for_revalidation();
 }
 
 const Shape& op::v1::AvgPool::get_pads_end() const
@@ -189,6 +192,7 @@ const Shape& op::v1::AvgPool::get_pads_end() const
 void op::v1::AvgPool::set_pads_end(const Shape& pads_end)
 {
     m_pads_end = pads_end;
+    mark_for_revalidation();
 }
 
 bool op::v1::AvgPool::get_exclude_pad() const
@@ -199,6 +203,7 @@ bool op::v1::AvgPool::get_exclude_pad() const
 void op::v1::AvgPool::set_exclude_pad(bool exclude_pad)
 {
     m_exclude_pad = exclude_pad;
+    mark_for_revalidation();
 }
 
 const op::PadType& op::v1::AvgPool::get_auto_pad() const
@@ -209,6 +214,7 @@ const op::PadType& op::v1::AvgPool::get_auto_pad() const
 void op::v1::AvgPool::set_auto_pad(const op::PadType& auto_pad)
 {
     m_auto_pad = auto_pad;
+    mark_for_revalidation();
 }
 
 op::RoundingType op::v1::AvgPool::get_rounding_type() const
@@ -219,6 +225,7 @@ op::RoundingType op::v1::AvgPool::get_rounding_type() const
 void op::v1::AvgPool::set_rounding_type(op::RoundingType rounding_type)
 {
     m_rounding_type = rounding_type;
+    mark_for_revalidation();
 }
 
 shared_ptr<Node> op::v1::AvgPool::clone_with_new_inputs(const OutputVector& new_args) const
@@ -380,6 +380,7 @@ void op::Constant::set_data_shape(const Shape& shape)
 {
     NGRAPH_CHECK(shape_size(shape) == shape_size(m_shape));
     m_shape = shape;
+    mark_for_revalidation();
 }
 
 shared_ptr<Node> op::Constant::clone_with_new_inputs(const OutputVector& new_args) const
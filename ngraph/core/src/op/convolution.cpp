@@ -194,6 +194,7 @@ void op::v1::ConvolutionBackpropData::set_output_shape(const Shape& shape)
     this->input(2).replace_source_output(
         op::Constant::create(this->get_input_element_type(2), Shape{shape.size()}, shape)
             ->output(0));
+    mark_for_revalidation();
 }
 
 void op::v1::ConvolutionBackpropData::infer_conv_backprop_output_spatial_shape(
@@ -346,6 +346,7 @@ void op::v1::TopK::set_axis(const int64_t axis)
         m_normalized_axis = UNKNOWN_NORMALIZED_AXIS;
     }
     m_axis = axis;
+    mark_for_revalidation();
 }
 
 void op::v1::TopK::set_axis(const Rank input_rank, const int64_t axis)
@@ -359,6 +360,7 @@ void op::v1::TopK::set_axis(const Rank input_rank, const int64_t axis)
         m_normalized_axis = UNKNOWN_NORMALIZED_AXIS;
     }
     m_axis = axis;
+    mark_for_revalidation();
 }
 
 uint64_t op::v1::TopK::get_axis() const
@@ -446,6 +448,7 @@ void op::v1::TopK::set_k(size_t k)
 {
     this->input(1).replace_source_output(
         op::Constant::create(element::i64, Shape{}, {k})->output(0));
+    mark_for_revalidation();
 }
 
 bool op::v1::TopK::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs) const
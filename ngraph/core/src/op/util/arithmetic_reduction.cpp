@@ -44,6 +44,7 @@ void op::util::ArithmeticReduction::set_reduction_axes(const AxisSet& reduction_
     this->input(1).replace_source_output(
         op::Constant::create(element::i64, Shape{reduction_axes.size()}, reduction_axes.to_vector())
             ->output(0));
+    mark_for_revalidation();
 }
 
 void op::util::ArithmeticReduction::validate_and_infer_types()
@@ -29,6 +29,7 @@ uint64_t op::util::IndexReduction::get_reduction_axis() const
 void op::util::IndexReduction::set_reduction_axis(uint64_t value)
 {
     m_axis = value;
+    mark_for_revalidation();
 }
 element::Type op::util::IndexReduction::get_index_element_type() const
 {
@@ -37,6 +38,7 @@ element::Type op::util::IndexReduction::get_index_element_type() const
 void op::util::IndexReduction::set_index_element_type(const element::Type& index_element_type)
 {
     m_index_element_type = index_element_type;
+    mark_for_revalidation();
 }
 
 void op::util::IndexReduction::validate_and_infer_types()
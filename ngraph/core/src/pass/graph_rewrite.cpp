@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -15,6 +16,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/profiler.hpp"
 #include "perf_counters.hpp"
 
 using namespace std;
@@ -73,6 +75,12 @@ namespace ngraph
     }     // namespace pass
 } // namespace ngraph
 
+namespace
+{
+    // set by matcher pass handlers when the pattern is matched, used by the profiler only
+    thread_local bool pattern_matched = false;
+} // namespace
+
 bool pass::BackwardGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     // Initialize execution queue with nodes in topological order
@@ -102,10 +110,14 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
 
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
+    auto& profiler = Profiler::get();
+    const bool profile = profiler.is_enabled();
+    std::vector<Profiler::Statistics> matcher_statistics(profile ? m_matchers.size() : 0);
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with type based root node are indexed by the root type, the rest of the matchers
+    // are generic and applied to every node
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> generic_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
     {
         // Skip passes that are disabled
@@ -115,8 +127,8 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher)
         {
-            all_roots_has_type = false;
-            break;
+            generic_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -128,9 +140,8 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
         }
 
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // it's type and use it in unordered_map as key for fast MatcherPass search. Otherwise type
+        // is unknown and the matcher is applied to all nodes.
         if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
         {
             if (auto any_type = dynamic_pointer_cast<pattern::op::WrapType>(p))
@@ -142,24 +153,44 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
             }
             else
             {
-                all_roots_has_type = false;
-                break;
+                generic_matchers.push_back(matcher_index);
             }
         }
         else
         {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Complete lists of the matchers for the node types met in the function: matchers registered
+    // for the type and its parents and the generic matchers in order of the registration
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto found = node_type_to_matchers.find(&type_info);
+        if (found != node_type_to_matchers.end())
+            return found->second;
+
+        auto& matchers = node_type_to_matchers[&type_info];
+        matchers = generic_matchers;
+        for (auto node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent)
+        {
+            auto typed_matchers = type_to_matcher.find(*node_type_info);
+            if (typed_matchers != type_to_matcher.end())
+            {
+                matchers.insert(
+                    matchers.end(), typed_matchers->second.begin(), typed_matchers->second.end());
+            }
+        }
+        std::sort(matchers.begin(), matchers.end());
+        return matchers;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -173,7 +204,25 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        if (profile)
+        {
+            pattern_matched = false;
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            const std::chrono::duration<double, std::milli> time =
+                std::chrono::steady_clock::now() - start;
+            auto& statistics = matcher_statistics[matcher_index];
+            statistics.calls = 1;
+            statistics.nodes_visited++;
+            statistics.matches += pattern_matched ? 1 : 0;
+            statistics.rewrites += status ? 1 : 0;
+            statistics.time_ms += time.count();
+        }
+        else
+        {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -191,9 +240,6 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty())
     {
         auto node = nodes_to_run.front();
@@ -211,57 +257,21 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
         {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
+        for (size_t matcher_index : get_matchers(node->get_type_info()))
         {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
-            {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
-                {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run)
+            if (run_matcher_pass(matcher_index, node))
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
-        {
-            for (auto& m_pass : m_matchers)
-            {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
+    }
 
-                if (run_matcher_pass(m_pass, node))
-                {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
+    for (size_t matcher_index = 0; matcher_index < matcher_statistics.size(); ++matcher_index)
+    {
+        if (matcher_statistics[matcher_index].calls)
+            profiler.add_matcher(m_matchers[matcher_index]->get_name(),
+                                 matcher_statistics[matcher_index]);
     }
     return rewritten;
 }
@@ -280,6 +290,8 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                 NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
                 NGRAPH_PASS_CALLBACK(m);
                 bool status = callback(*m.get());
+                // the callback may run other matcher passes, so the flag is set after it
+                pattern_matched = true;
                 // explicitly clear Matcher state because it holds pointers to matched nodes
                 m->clear_state();
                 return status;
@@ -417,6 +429,8 @@ void ngraph::pass::MatcherPass::register_matcher(const std::shared_ptr<ngraph::p
             NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
             NGRAPH_PASS_CALLBACK(m);
             bool status = callback(*m.get());
+            // the callback may run other matcher passes, so the flag is set after it
+            pattern_matched = true;
             // explicitly clear Matcher state because it holds pointers to matched nodes
             m->clear_state();
             return status;
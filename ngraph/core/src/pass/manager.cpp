@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -18,6 +19,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/profiler.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
 #include "perf_counters.hpp"
@@ -40,6 +42,19 @@ namespace ngraph
     }     // namespace pass
 } // namespace ngraph
 
+namespace
+{
+    // depth of the nested pass::Manager::run_passes calls in the current thread
+    thread_local size_t run_passes_depth = 0;
+
+    struct RunPassesScope
+    {
+        RunPassesScope() { run_passes_depth++; }
+        ~RunPassesScope() { run_passes_depth--; }
+        bool is_outermost() const { return run_passes_depth == 1; }
+    };
+} // namespace
+
 pass::Manager::Manager()
     : m_pass_config(std::make_shared<PassConfig>())
     , m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
@@ -58,6 +73,8 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::Manager::run_passes");
 
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    auto& profiler = pass::Profiler::get();
+    RunPassesScope run_passes_scope;
 
     size_t index = 0;
     stopwatch pass_timer;
@@ -77,6 +94,8 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
                      pass::internal::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
+        const auto pass_start = chrono::steady_clock::now();
+        bool pass_changed = false;
 
         NGRAPH_SUPPRESS_DEPRECATED_START
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass))
@@ -93,6 +112,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
             function_changed = GraphRewrite(matcher_pass).run_on_function(func);
+            pass_changed = function_changed;
         }
         else if (auto function_pass = dynamic_pointer_cast<FunctionPass>(pass))
         {
@@ -117,6 +137,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             else
             {
                 function_changed = function_pass->run_on_function(func);
+                pass_changed = function_changed;
             }
         }
         else if (auto node_pass = dynamic_pointer_cast<NodePass>(pass))
@@ -129,8 +150,9 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             }
             for (shared_ptr<Node> n : func->get_ops())
             {
-                function_changed |= node_pass->run_on_node(n);
+                pass_changed |= node_pass->run_on_node(n);
             }
+            function_changed |= pass_changed;
         }
         NGRAPH_SUPPRESS_DEPRECATED_END
 
@@ -153,6 +175,12 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         }
         index++;
         pass_timer.stop();
+        if (profiler.is_enabled())
+        {
+            const chrono::duration<double, milli> pass_time =
+                chrono::steady_clock::now() - pass_start;
+            profiler.add_pass(pass->get_name(), pass_time.count(), pass_changed);
+        }
         if (profile_enabled)
         {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
@@ -162,4 +190,9 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    // the report is updated once the whole pipeline is done
+    if (run_passes_scope.is_outermost() && profiler.is_enabled())
+    {
+        profiler.write_report();
+    }
 }
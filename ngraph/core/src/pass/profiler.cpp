@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/pass/profiler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    string escape_json(const string& value)
+    {
+        ostringstream escaped;
+        for (auto c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                escaped << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                escaped << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(c)
+                        << dec;
+            }
+            else
+            {
+                escaped << c;
+            }
+        }
+        return escaped.str();
+    }
+
+    void write_statistics(ostream& stream,
+                          const pass::Profiler::StatisticsMap& statistics,
+                          bool matchers)
+    {
+        using Entry = pass::Profiler::StatisticsMap::value_type;
+        vector<const Entry*> sorted;
+        for (const auto& entry : statistics)
+        {
+            sorted.push_back(&entry);
+        }
+        stable_sort(sorted.begin(), sorted.end(), [](const Entry* lhs, const Entry* rhs) {
+            return lhs->second.time_ms > rhs->second.time_ms;
+        });
+
+        stream << "[";
+        for (size_t i = 0; i < sorted.size(); ++i)
+        {
+            const auto& name = sorted[i]->first;
+            const auto& value = sorted[i]->second;
+            stream << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << escape_json(name)
+                   << "\", \"time_ms\": " << value.time_ms << ", \"calls\": " << value.calls;
+            if (matchers)
+            {
+                stream << ", \"nodes_visited\": " << value.nodes_visited
+                       << ", \"matches\": " << value.matches;
+            }
+            stream << ", \"rewrites\": " << value.rewrites << "}";
+        }
+        stream << (sorted.empty() ? "]" : "\n  ]");
+    }
+} // namespace
+
+pass::Profiler& pass::Profiler::get()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+pass::Profiler::Profiler()
+    : m_report_path(getenv_string("NGRAPH_PASS_PROFILE_REPORT"))
+{
+    m_enabled = !m_report_path.empty();
+}
+
+pass::Profiler::~Profiler()
+{
+    write_report();
+}
+
+void pass::Profiler::reset()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_passes.clear();
+    m_matchers.clear();
+}
+
+void pass::Profiler::add_pass(const string& name, double time_ms, bool changed)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto& statistics = m_passes[name];
+    statistics.calls++;
+    statistics.rewrites += changed ? 1 : 0;
+    statistics.time_ms += time_ms;
+}
+
+void pass::Profiler::add_matcher(const string& name, const Statistics& statistics)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto& total = m_matchers[name];
+    total.calls += statistics.calls;
+    total.nodes_visited += statistics.nodes_visited;
+    total.matches += statistics.matches;
+    total.rewrites += statistics.rewrites;
+    total.time_ms += statistics.time_ms;
+}
+
+pass::Profiler::StatisticsMap pass::Profiler::get_pass_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_passes;
+}
+
+pass::Profiler::StatisticsMap pass::Profiler::get_matcher_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_matchers;
+}
+
+void pass::Profiler::write_json(ostream& stream) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    stream << "{\n  \"passes\": ";
+    write_statistics(stream, m_passes, false);
+    stream << ",\n  \"matchers\": ";
+    write_statistics(stream, m_matchers, true);
+    stream << "\n}\n";
+}
+
+void pass::Profiler::write_report() const
+{
+    if (m_report_path.empty())
+        return;
+    ofstream report(m_report_path);
+    if (!report)
+    {
+        NGRAPH_WARN << "Cannot write transformations profiling report to " << m_report_path;
+        return;
+    }
+    write_json(report);
+}
@@ -4,6 +4,7 @@
 
 #include "ngraph/pass/validate.hpp"
 #include "itt.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 
 using namespace ngraph;
@@ -12,6 +13,13 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::Validate, "ngraph::pass::Validate", 0);
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    // NGRAPH_ENABLE_INCREMENTAL_VALIDATION=1 revalidates only the nodes marked by the previous
+    // passes, a transformation which modifies the attributes of an operation in place without
+    // marking it for revalidation is caught only by the full validation
+    static const bool incremental = getenv_bool("NGRAPH_ENABLE_INCREMENTAL_VALIDATION");
+    if (incremental)
+        f->validate_marked_nodes_and_infer_types();
+    else
+        f->validate_nodes_and_infer_types();
     return false;
 }
@@ -443,4 +443,78 @@ TEST(build_graph, build_graph_with_remove_parameter_indexing)
     EXPECT_EQ(nodes.size(), 9);
 
     f->validate_nodes_and_infer_types();
-}
\ No newline at end of file
+}
+
+TEST(build_graph, incremental_validation_marks_only_changed_nodes)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 4});
+    auto arg2 = make_shared<opset5::Parameter>(element::f32, Shape{3, 4});
+    auto relu = make_shared<opset5::Relu>(arg);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto relu2 = make_shared<opset5::Relu>(arg2);
+    auto f = make_shared<Function>(OutputVector{abs, relu2}, ParameterVector{arg, arg2});
+
+    f->validate_marked_nodes_and_infer_types();
+    for (const auto& node : f->get_ops())
+        EXPECT_FALSE(node->is_marked_for_revalidation());
+
+    abs->input(0).replace_source_output(arg2);
+    EXPECT_TRUE(abs->is_marked_for_revalidation());
+    EXPECT_FALSE(relu->is_marked_for_revalidation());
+    EXPECT_FALSE(relu2->is_marked_for_revalidation());
+
+    f->validate_marked_nodes_and_infer_types();
+    EXPECT_EQ(abs->get_output_shape(0), (Shape{3, 4}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{3, 4}));
+    for (const auto& node : f->get_ops())
+        EXPECT_FALSE(node->is_marked_for_revalidation());
+}
+
+TEST(build_graph, incremental_validation_propagates_shape_values)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 3});
+    auto data = make_shared<opset5::Parameter>(element::f32, Shape{6});
+    auto shape_of = make_shared<opset5::ShapeOf>(arg);
+    auto gather = make_shared<opset5::Gather>(
+        shape_of,
+        op::Constant::create(element::i64, Shape{2}, {1, 0}),
+        op::Constant::create(element::i64, Shape{}, {0}));
+    auto reshape = make_shared<opset5::Reshape>(data, gather, false);
+    auto f = make_shared<Function>(OutputVector{reshape}, ParameterVector{arg, data});
+
+    f->validate_marked_nodes_and_infer_types();
+    EXPECT_EQ(reshape->get_output_shape(0), (Shape{3, 2}));
+
+    // neither the shape of ShapeOf nor Gather output changes, only their values
+    arg->set_partial_shape(Shape{1, 6});
+    f->validate_marked_nodes_and_infer_types();
+    EXPECT_EQ(reshape->get_output_shape(0), (Shape{6, 1}));
+
+    arg->set_partial_shape(PartialShape{Dimension::dynamic(), 2});
+    data->set_partial_shape(PartialShape::dynamic(1));
+    f->validate_marked_nodes_and_infer_types();
+    EXPECT_TRUE(reshape->get_output_partial_shape(0).same_scheme(
+        PartialShape{2, Dimension::dynamic()}));
+}
+
+TEST(build_graph, incremental_validation_revalidates_changed_attributes)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{1, 3, 8, 8});
+    auto weights = op::Constant::create(element::f32, Shape{4, 3, 1, 1}, vector<float>(12, 1.f));
+    auto conv = make_shared<opset5::Convolution>(arg,
+                                                 weights,
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+    auto relu = make_shared<opset5::Relu>(conv);
+    auto f = make_shared<Function>(OutputVector{relu}, ParameterVector{arg});
+
+    f->validate_marked_nodes_and_infer_types();
+    EXPECT_EQ(f->get_output_shape(0), (Shape{1, 4, 8, 8}));
+
+    conv->set_strides(Strides{2, 2});
+    EXPECT_TRUE(conv->is_marked_for_revalidation());
+    f->validate_marked_nodes_and_infer_types();
+    EXPECT_EQ(f->get_output_shape(0), (Shape{1, 4, 4, 4}));
+}
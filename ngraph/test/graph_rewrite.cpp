@@ -6,6 +6,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/profiler.hpp>
+#include <sstream>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -173,6 +175,42 @@ TEST(GraphRewriteTest, ManagerCallback)
     ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
 }
 
+TEST(GraphRewriteTest, ProfilerCollectsStatistics)
+{
+    auto& profiler = pass::Profiler::get();
+    const bool enabled = profiler.is_enabled();
+    profiler.set_enabled(true);
+    profiler.reset();
+
+    auto f = get_function();
+    pass::Manager manager;
+    auto anchor = manager.register_pass<Anchor>();
+    anchor->add_matcher<TestPass>();
+    // Divide is matched but the callback rejects the transformation
+    manager.run_passes(f);
+    manager.get_pass_config()->set_callback(get_callback());
+    manager.run_passes(f);
+    profiler.set_enabled(enabled);
+
+    auto matchers = profiler.get_matcher_statistics();
+    ASSERT_EQ(matchers.count("TestMatcher"), 1);
+    EXPECT_EQ(matchers["TestMatcher"].calls, 2);
+    EXPECT_EQ(matchers["TestMatcher"].nodes_visited, 8);
+    EXPECT_EQ(matchers["TestMatcher"].matches, 2);
+    EXPECT_EQ(matchers["TestMatcher"].rewrites, 1);
+
+    auto passes = profiler.get_pass_statistics();
+    ASSERT_EQ(passes.count("Anchor"), 1);
+    EXPECT_EQ(passes["Anchor"].calls, 2);
+    EXPECT_EQ(passes["Anchor"].rewrites, 1);
+
+    std::stringstream report;
+    profiler.write_json(report);
+    EXPECT_NE(report.str().find("\"name\": \"TestMatcher\""), std::string::npos);
+    EXPECT_NE(report.str().find("\"name\": \"Anchor\""), std::string::npos);
+    profiler.reset();
+}
+
 TEST(GraphRewriteTest, ManagerCallback2)
 {
     auto f = get_function();
@@ -313,6 +351,31 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedMatcherPassWithGenericMatcherPass)
+{
+    auto f = get_function();
+    auto& profiler = pass::Profiler::get();
+    const bool enabled = profiler.is_enabled();
+    profiler.set_enabled(true);
+    profiler.reset();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    auto ref_order = f->get_ordered_ops();
+    anchor.run_on_function(f);
+    profiler.set_enabled(enabled);
+
+    // the generic matcher pass is applied to all nodes, the type based one to Divide only
+    ASSERT_EQ(order, ref_order);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    auto matchers = profiler.get_matcher_statistics();
+    EXPECT_EQ(matchers["GatherNodesPass"].nodes_visited, ref_order.size());
+    EXPECT_EQ(matchers["TestMatcher"].nodes_visited, 1);
+    profiler.reset();
+}
+
 TEST(PassConfigTest, Test1)
 {
     {